@@ -4,21 +4,287 @@
 #include "../src/baseSimulator.h"
 #include "../src/baseSimulator.hh"
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 using T = double;
 
-void BM_simRun(benchmark::State& state) {
+// Number of heap allocations of the benchmark process, counted by the replaced global operator new.
+std::atomic<size_t> heapAllocations{0};
+
+// GCC sees the malloc of the inlined operator new and the free of the inlined operator delete as a mismatched pair
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(std::size_t size) {
+  heapAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+#pragma GCC diagnostic pop
+
+// Wall-clock times of the simulation phases, accumulated over the benchmark iterations and reported as averages.
+struct PhaseTimings {
+  double load = 0.0;
+  double initialize = 0.0;
+  double nodalAnalysis = 0.0;
+  double eventLoop = 0.0;
+  double steps = 0.0;             // stored states, i.e., events of the abstract simulations and steps of the hybrid simulations
+  double allocations = 0.0;       // heap allocations during simulate()
+  double poolAllocations = 0.0;   // events and droplet boundaries allocated from the memory pool of the simulation
+  double poolHeapAllocations = 0.0;
+
+  void report(benchmark::State& state) const {
+    state.counters["load"] = benchmark::Counter(load, benchmark::Counter::kAvgIterations);
+    state.counters["initialize"] = benchmark::Counter(initialize, benchmark::Counter::kAvgIterations);
+    state.counters["nodalAnalysis"] = benchmark::Counter(nodalAnalysis, benchmark::Counter::kAvgIterations);
+    state.counters["eventLoop"] = benchmark::Counter(eventLoop, benchmark::Counter::kAvgIterations);
+    state.counters["steps"] = benchmark::Counter(steps, benchmark::Counter::kAvgIterations);
+    state.counters["allocations"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+    state.counters["poolAllocations"] = benchmark::Counter(poolAllocations, benchmark::Counter::kAvgIterations);
+    state.counters["poolHeapAllocations"] = benchmark::Counter(poolHeapAllocations, benchmark::Counter::kAvgIterations);
+    if (steps > 0.0) {
+      state.counters["allocationsPerStep"] = allocations / steps;
+      state.counters["poolAllocationsPerStep"] = poolAllocations / steps;
+    }
+  }
+};
+
+// Load a fresh network and simulation from the JSON definition and simulate it.
+void loadAndSimulate(const json& definition, PhaseTimings& phases) {
+  auto start = std::chrono::steady_clock::now();
+  arch::Network<T> network = porting::networkFromJSON<T>(definition);
+  sim::Simulation<T> testSimulation;
+  porting::simulationFromJSON<T>(definition, &network, testSimulation);
+  phases.load += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  size_t allocationsBefore = heapAllocations.load(std::memory_order_relaxed);
+  testSimulation.simulate();
+  phases.allocations += heapAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+  phases.poolAllocations += testSimulation.getMemoryPool().getAllocations();
+  phases.poolHeapAllocations += testSimulation.getMemoryPool().getHeapAllocations();
+  phases.steps += testSimulation.getSimulationResults()->getStates().getAddedStates();
+
+  const sim::SimulationTimings& timings = testSimulation.getTimings();
+  phases.initialize += timings.initialize;
+  phases.nodalAnalysis += timings.nodalAnalysis;
+  phases.eventLoop += timings.eventLoop;
+}
+
+// Simulate the JSON definition in every iteration. The load time and the phases of the simulation are reported as counters
+// (in s), together with the allocation counts. Unless warmUp is false, one untimed run precedes the iterations, such that
+// one-time allocations (e.g., static buffers and the first growth of containers) are not counted; the allocation counter
+// is reset afterwards.
+void runSimulation(benchmark::State& state, const json& definition, bool warmUp = true) {
+  if (warmUp) {
+    PhaseTimings warmUpPhases;
+    loadAndSimulate(definition, warmUpPhases);
+    heapAllocations.store(0, std::memory_order_relaxed);
+  }
+  PhaseTimings phases;
+  for (auto _ : state) {
+    loadAndSimulate(definition, phases);
+  }
+  phases.report(state);
+}
 
-  std::string file = "../examples/Hybrid/Network4a.JSON";
+json loadDefinition(const std::string& file) {
+  std::ifstream f(file);
+  return json::parse(f);
+}
+
+// Generated network of the given topology (0: grid, 1: ladder, 2: tree, 3: random) and size.
+porting::GeneratorSettings<T> generatorSettings(int64_t topology, int64_t nNodes) {
+  porting::GeneratorSettings<T> settings;
+  settings.topology = static_cast<porting::NetworkTopology>(topology);
+  settings.nNodes = nNodes;
+  return settings;
+}
 
-  // Load and set the network from a JSON file
-  arch::Network<T> network = porting::networkFromJSON<T>(file);
+void BM_abstractContinuous(benchmark::State& state) {
+  runSimulation(state, porting::generateSimulation(generatorSettings(state.range(0), state.range(1))));
+}
+BENCHMARK(BM_abstractContinuous)->ArgsProduct({{0, 1, 2, 3}, benchmark::CreateRange(1<<6, 1<<12, 4)})->Unit(benchmark::kMillisecond);
+
+void BM_bigDroplet(benchmark::State& state) {
+  // one droplet per 16 nodes on a ladder
+  porting::GeneratorSettings<T> settings = generatorSettings(1, state.range(0));
+  settings.platform = "BigDroplet";
+  settings.nDroplets = state.range(0) / 16;
+  runSimulation(state, porting::generateSimulation(settings));
+}
+BENCHMARK(BM_bigDroplet)->Arg(32)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+void BM_instantaneousMixing(benchmark::State& state) {
+  porting::GeneratorSettings<T> settings = generatorSettings(1, state.range(0));
+  settings.platform = "Mixing";
+  runSimulation(state, porting::generateSimulation(settings));
+}
+BENCHMARK(BM_instantaneousMixing)->Arg(16)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+void BM_diffusiveMixing(benchmark::State& state) {
+  runSimulation(state, loadDefinition("../examples/Abstract/Mixing/DiffusionCase" + std::to_string(state.range(0)) + ".JSON"));
+}
+BENCHMARK(BM_diffusiveMixing)->DenseRange(1, 4)->Unit(benchmark::kMillisecond);
+
+void BM_hybridContinuous(benchmark::State& state) {
+  // the hybrid simulations are too expensive for a warm-up run
+  runSimulation(state, loadDefinition("../examples/Hybrid/Network" + std::to_string(state.range(0)) + "a.JSON"), false);
+}
+BENCHMARK(BM_hybridContinuous)->DenseRange(1, 4)->Unit(benchmark::kSecond)->Iterations(1);
+
+void BM_hybridMixing(benchmark::State& state) {
+  runSimulation(state, loadDefinition("../examples/Hybrid/Mixing1a.JSON"), false);
+}
+BENCHMARK(BM_hybridMixing)->Unit(benchmark::kSecond)->Iterations(1);
+
+void BM_nodalAnalysis(benchmark::State& state) {
+
+  // Generated ladder network with range(0) rungs, whose channels have different resistances
+  arch::Network<T> network = porting::networkFromJSON<T>(porting::generateNetwork(generatorSettings(1, 2 * state.range(0))));
+  for (auto& [channelId, channel] : network.getChannels()) {
+    channel->setResistance(1.0 + channelId % 7);
+  }
+  network.addPressurePump(0, 1, 100.0);
+  network.sortGroups();
+
+  // Repeatedly assemble and solve the system of equations, of which only the assembly is timed
+  nodal::NodalAnalysis<T> nodalAnalysis(&network);
+  nodalAnalysis.setFactorizationReuse(true);
+  double total = 0.0;
+  for (auto _ : state) {
+    double assemblyTime = nodalAnalysis.getAssemblyTime();
+    double elapsedTime = nodalAnalysis.getElapsedTime();
+    nodalAnalysis.conductNodalAnalysis();
+    state.SetIterationTime(nodalAnalysis.getAssemblyTime() - assemblyTime);
+    total += nodalAnalysis.getElapsedTime() - elapsedTime;
+  }
+  // the complete nodal analysis, including the factorization and the solve
+  state.counters["total"] = benchmark::Counter(total, benchmark::Counter::kAvgIterations);
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_nodalAnalysis)->RangeMultiplier(4)->Range(1<<8, 1<<14)->UseManualTime()->Complexity(benchmark::oN);
+
+void BM_sortGroups(benchmark::State& state) {
+
+  // Generated grid network with range(0)^2 nodes and ~2*range(0)^2 channels (~100k channels for 224x224)
+  const json definition = porting::generateNetwork(generatorSettings(0, state.range(0) * state.range(0)));
+  size_t nChannels = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto network = std::make_unique<arch::Network<T>>(porting::networkFromJSON<T>(definition));
+    nChannels = network->getChannels().size();
+    state.ResumeTiming();
+
+    network->sortGroups();
+
+    // exclude the destruction of the network from the timing
+    state.PauseTiming();
+    network.reset();
+    state.ResumeTiming();
+  }
+  state.SetComplexityN(nChannels);
+}
+BENCHMARK(BM_sortGroups)->Arg(56)->Arg(112)->Arg(224)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oN);
+
+void BM_mixingSpecies(benchmark::State& state) {
+
+  const int nSpecies = state.range(0);
+  const int adThreads = state.range(1);
+
+  std::ifstream file("../examples/Hybrid/Mixing1a.JSON");
+  json jsonString = json::parse(file);
+
+  // Replicate the single species of the example into nSpecies species with different diffusivities
+  json specie = jsonString["simulation"]["species"][0];
+  json& mixture = jsonString["simulation"]["mixtures"][0];
+  jsonString["simulation"]["species"] = json::array();
+  mixture["species"] = json::array();
+  mixture["concentrations"] = json::array();
+  for (int i = 0; i < nSpecies; ++i) {
+    specie["name"] = "Specie" + std::to_string(i);
+    specie["diffusivity"] = 1e-8 * (i + 1);
+    jsonString["simulation"]["species"].push_back(specie);
+    mixture["species"].push_back(i);
+    mixture["concentrations"].push_back(1.1);
+  }
+  jsonString["simulation"]["settings"]["simulators"][0]["adThreads"] = adThreads;
+
+  runSimulation(state, jsonString);
+}
+BENCHMARK(BM_mixingSpecies)->ArgsProduct({{1, 2, 4}, {1, 4}})->Unit(benchmark::kSecond)->Iterations(1);
+
+// Stream buffer that discards the written characters and only counts them, such that exports are timed without disk I/O.
+class CountingBuffer : public std::streambuf {
+public:
+  size_t bytes = 0;
+
+protected:
+  int_type overflow(int_type c) override {
+    bytes += (c != traits_type::eof());
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char*, std::streamsize n) override {
+    bytes += n;
+    return n;
+  }
+};
+
+// Export of nStates states of a network with nChannels channels and as many nodes, as JSON lines (0) or binary rows (1).
+// The columns are built once per file and every state is written in their order.
+void BM_resultExport(benchmark::State& state) {
+
+  const int format = state.range(0);
+  const int nStates = state.range(1);
+  const int nChannels = state.range(2);
+
+  sim::Simulation<T> simulation;
+  std::unordered_map<int, T> pressures;
+  std::unordered_map<int, T> flowRates;
+  for (int i = 0; i < nChannels; ++i) {
+    pressures.try_emplace(i, 1000.0 - i);
+    flowRates.try_emplace(i, 1e-9 * (i % 97));
+  }
+  result::State<T> resultState(0, 0.0, pressures, flowRates);
 
-  // Load and set the simulation from a JSON file
-  sim::Simulation<T> testSimulation = porting::simulationFromJSON<T>(file, &network);
+  double bytes = 0.0;
   for (auto _ : state) {
-    testSimulation.simulate();
+    CountingBuffer buffer;
+    std::ostream file(&buffer);
+    result::ColumnIndex nodeColumns;
+    result::ColumnIndex edgeColumns;
+    nodeColumns.add(resultState.getPressures());
+    edgeColumns.add(resultState.getFlowRates());
+    std::vector<double> row;
+    if (format == 1) {
+      porting::writeBinaryHeader(file, nStates, nodeColumns, edgeColumns);
+    }
+    for (int i = 0; i < nStates; ++i) {
+      if (format == 0) {
+        file << porting::writeState(&resultState, &simulation, nodeColumns, edgeColumns).dump() << '\n';
+      } else {
+        porting::writeBinaryRow(file, &resultState, nodeColumns, edgeColumns, row);
+      }
+    }
+    bytes += buffer.bytes;
   }
+  state.counters["bytes"] = benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * nStates);
 }
-BENCHMARK(BM_simRun);
+BENCHMARK(BM_resultExport)->ArgsProduct({{0, 1}, {1000, 10000}, {1000, 10000}})->Unit(benchmark::kSecond)->Iterations(1);
 
 BENCHMARK_MAIN(); 
\ No newline at end of file
@@ -1,17 +1,27 @@
 """MMFT Simulation Package"""
 
 from mmft.simulator.pysimulator import (
+    BinaryResult,
     ChannelType,
     Network,
+    ParameterSweep,
     Platform,
     Simulation,
+    StateStorage,
+    SweepResult,
+    SweepVariant,
     Type
 )
 
 __all__ = [
+    'BinaryResult',
     'ChannelType',
     'Network',
+    'ParameterSweep',
     'Platform',
     'Simulation',
+    'StateStorage',
+    'SweepResult',
+    'SweepVariant',
     'Type'
 ]
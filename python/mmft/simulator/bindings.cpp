@@ -1,3 +1,4 @@
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -12,6 +13,24 @@ using T = double;
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+/**
+ * @brief Create a read-only NumPy array that views memory of the owner without copying it. The array keeps the owner alive.
+ */
+template<typename V>
+py::array_t<V> view(py::handle owner, const V* data, std::vector<py::ssize_t> shape, std::vector<py::ssize_t> strides) {
+	py::array_t<V> array(shape, strides, data, owner);
+	array.attr("setflags")("write"_a = false);
+	return array;
+}
+
+/**
+ * @brief Create a read-only NumPy array that views a contiguous array of a binary result.
+ */
+template<typename V>
+py::array_t<V> view(py::handle owner, const V* data, std::int64_t size) {
+	return view<V>(owner, data, { size }, { static_cast<py::ssize_t>(sizeof(V)) });
+}
+
 PYBIND11_MODULE(pysimulator, m) {
 	m.doc() = "Python binding for the MMFT-Simulator.";
 
@@ -28,10 +47,15 @@ PYBIND11_MODULE(pysimulator, m) {
 		.value("continuous", sim::Platform::Continuous)
 		.value("bigDroplet", sim::Platform::BigDroplet);
 
+	py::enum_<result::StateStorage>(m, "StateStorage")
+		.value("full", result::StateStorage::Full)
+		.value("delta", result::StateStorage::Delta)
+		.value("columnar", result::StateStorage::Columnar);
+
 	py::class_<arch::Network<T>>(m, "Network")
 		.def(py::init<>())
 		.def("sort", &arch::Network<T>::sortGroups, "Sort the nodes, channels and modules of the network.")
-		.def("valid", &arch::Network<T>::isNetworkValid, "Check if the current network is valid.")
+		.def("valid", &arch::Network<T>::isNetworkValid, py::arg("nThreads") = 1, "Check if the current network is valid.")
 		.def("addNode", [](arch::Network<T> &network, T x, T y, bool ground) {
 			return network.addNode(x, y, ground)->getId();
 			}, "Add a new node to the network.")
@@ -128,6 +152,22 @@ PYBIND11_MODULE(pysimulator, m) {
 		.def("setNaiveScheme", [](sim::Simulation<T> & simulation, T alpha, T beta, int theta) {
 				simulation.setNaiveHybridScheme(alpha, beta, theta);
 			})
+		.def("setAitkenScheme", [](sim::Simulation<T> & simulation, T alpha, T beta, int theta) {
+				simulation.setAitkenHybridScheme(alpha, beta, theta);
+			})
+		.def("setCfdThreads", &sim::Simulation<T>::setCfdThreads, "Set the number of threads that solve the CFD simulators concurrently.")
+		.def("setStateStorage", [](sim::Simulation<T> &simulation, result::StateStorage storage, int keyframeInterval) {
+				simulation.getSimulationResults()->setStateStorage(storage, keyframeInterval);
+			}, py::arg("storage"), py::arg("keyframeInterval") = 16, "Set how the states of the result are stored.")
+		.def("setRetainedStates", [](sim::Simulation<T> &simulation, std::size_t retainedStates) {
+				simulation.getSimulationResults()->setRetainedStates(retainedStates);
+			}, "Keep only the most recent states in memory (0 keeps all states).")
+		.def("addJsonLinesSink", [](sim::Simulation<T> &simulation, std::string file) {
+				simulation.addStateSink(std::make_shared<porting::JsonLinesSink<T>>(file));
+			}, "Stream each state as one line of JSON to a file.")
+		.def("addBinarySink", [](sim::Simulation<T> &simulation, std::string file) {
+				simulation.addStateSink(std::make_shared<porting::BinarySink<T>>(file));
+			}, "Stream the time, pressures and flow rates of each state as binary rows to a file.")
 		.def("simulate", &sim::Simulation<T>::simulate)
 		.def("print", &sim::Simulation<T>::printResults)
 		.def("loadSimulation", [](sim::Simulation<T> &simulation, arch::Network<T> &network, std::string file) { 
@@ -135,7 +175,89 @@ PYBIND11_MODULE(pysimulator, m) {
 			})
 		.def("saveResult", [](sim::Simulation<T> &simulation, std::string file) {
 				porting::resultToJSON(file, &simulation);
-			});
+			})
+		.def("saveBinaryResult", [](sim::Simulation<T> &simulation, std::string file) {
+				porting::resultToBinary(file, &simulation);
+			}, "Store the result in the binary result format, which can be read with BinaryResult.")
+		.def("getTimes", [](sim::Simulation<T> &simulation) {
+				return simulation.getSimulationResults()->getStates().getTimes();
+			}, "Get the simulation time of all states.")
+		.def("getPressureSeries", [](sim::Simulation<T> &simulation, int nodeId) {
+				return simulation.getSimulationResults()->getStates().getPressureSeries(nodeId);
+			}, "Get the pressure of a node in all states.")
+		.def("getFlowRateSeries", [](sim::Simulation<T> &simulation, int edgeId) {
+				return simulation.getSimulationResults()->getStates().getFlowRateSeries(edgeId);
+			}, "Get the flow rate of a channel or pump in all states.");
+
+	py::class_<porting::BinaryResult>(m, "BinaryResult")
+		.def(py::init<std::string>(), "Map a result in the binary result format into memory. All arrays are read-only views of the file.")
+		.def_property_readonly("nodeIds", [](py::object self) {
+				auto& result = self.cast<porting::BinaryResult&>();
+				return view(self, result.getNodeIds(), result.getNumberOfNodes());
+			}, "Node id of each pressure column.")
+		.def_property_readonly("edgeIds", [](py::object self) {
+				auto& result = self.cast<porting::BinaryResult&>();
+				return view(self, result.getEdgeIds(), result.getNumberOfEdges());
+			}, "Edge id of each flow rate column.")
+		.def_property_readonly("times", [](py::object self) {
+				auto& result = self.cast<porting::BinaryResult&>();
+				py::ssize_t row = result.getRowSize() * sizeof(double);
+				return view<double>(self, result.getRows(), { result.getNumberOfStates() }, { row });
+			}, "Time of each state in s.")
+		.def_property_readonly("pressures", [](py::object self) {
+				auto& result = self.cast<porting::BinaryResult&>();
+				py::ssize_t row = result.getRowSize() * sizeof(double);
+				return view<double>(self, result.getRows() + 1, { result.getNumberOfStates(), result.getNumberOfNodes() }, { row, sizeof(double) });
+			}, "Pressures in Pa with a row per state and a column per node.")
+		.def_property_readonly("flowRates", [](py::object self) {
+				auto& result = self.cast<porting::BinaryResult&>();
+				py::ssize_t row = result.getRowSize() * sizeof(double);
+				return view<double>(self, result.getRows() + 1 + result.getNumberOfNodes(), { result.getNumberOfStates(), result.getNumberOfEdges() }, { row, sizeof(double) });
+			}, "Flow rates in m^3/s with a row per state and a column per edge.")
+		.def_property_readonly("dropletPositions", [](py::object self) {
+				auto& positions = self.cast<porting::BinaryResult&>().getDropletPositions();
+				py::dict dict;
+				dict["states"] = view(self, positions.states, positions.size);
+				dict["dropletIds"] = view(self, positions.dropletIds, positions.size);
+				dict["boundaryOffsets"] = view(self, positions.boundaryOffsets, (positions.size > 0) ? positions.size + 1 : 0);
+				dict["channelOffsets"] = view(self, positions.channelOffsets, (positions.size > 0) ? positions.size + 1 : 0);
+				dict["boundaryChannels"] = view(self, positions.boundaryChannels, positions.nBoundaries);
+				dict["volumeTowardsNodeA"] = view(self, positions.volumeTowardsNodeA, positions.nBoundaries);
+				dict["boundaryPositions"] = view(self, positions.boundaryPositions, positions.nBoundaries);
+				dict["channelIds"] = view(self, positions.channelIds, positions.nChannels);
+				return dict;
+			}, "Droplet positions of all states, with the boundaries and occupied channels of each position given by offsets.")
+		.def_property_readonly("mixturePositions", [](py::object self) {
+				auto& positions = self.cast<porting::BinaryResult&>().getMixturePositions();
+				py::dict dict;
+				dict["states"] = view(self, positions.states, positions.size);
+				dict["channelIds"] = view(self, positions.channelIds, positions.size);
+				dict["mixtureIds"] = view(self, positions.mixtureIds, positions.size);
+				dict["starts"] = view(self, positions.starts, positions.size);
+				dict["ends"] = view(self, positions.ends, positions.size);
+				return dict;
+			}, "Mixture positions of all states.");
+
+	py::class_<porting::SweepVariant<T>>(m, "SweepVariant")
+		.def(py::init<>())
+		.def_readwrite("pressurePumps", &porting::SweepVariant<T>::pressurePumps, "Pressure of the pressure pumps in Pa, by pump id.")
+		.def_readwrite("flowRatePumps", &porting::SweepVariant<T>::flowRatePumps, "Flow rate of the flow rate pumps in m^3/s, by pump id.")
+		.def_readwrite("injectionTimes", &porting::SweepVariant<T>::injectionTimes, "Injection time of the droplet or mixture injections in s, by injection id.");
+
+	py::class_<porting::SweepResult<T>>(m, "SweepResult")
+		.def_readonly("nStates", &porting::SweepResult<T>::nStates, "Number of states of the run.")
+		.def_readonly("time", &porting::SweepResult<T>::time, "Time of the last state in s.")
+		.def_readonly("pressures", &porting::SweepResult<T>::pressures, "Pressures of the last state in Pa, in the order of the node ids of the sweep.")
+		.def_readonly("flowRates", &porting::SweepResult<T>::flowRates, "Flow rates of the last state in m^3/s, in the order of the edge ids of the sweep.")
+		.def_readonly("error", &porting::SweepResult<T>::error, "Message of the error that stopped the run, empty if the run succeeded.");
+
+	py::class_<porting::ParameterSweep<T>>(m, "ParameterSweep")
+		.def(py::init<std::string>(), "Load the network and the abstract simulation of a parameter sweep from a JSON file.")
+		.def("setThreads", &porting::ParameterSweep<T>::setThreads, "Set the number of threads that execute the runs. 0 uses all hardware threads.")
+		.def("getNodeIds", &porting::ParameterSweep<T>::getNodeIds, "Get the node ids in the order of the pressures of the results.")
+		.def("getEdgeIds", &porting::ParameterSweep<T>::getEdgeIds, "Get the edge ids in the order of the flow rates of the results.")
+		.def("run", &porting::ParameterSweep<T>::run, py::call_guard<py::gil_scoped_release>(),
+			"Simulate all variants in parallel, each on its own copy of the network, and return the result of each run.");
 
 	#ifdef VERSION_INFO
 	m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
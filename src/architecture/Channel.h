@@ -106,6 +106,12 @@ class Channel : public Edge<T>{
         */
         Channel(int id, std::shared_ptr<Node<T>> nodeA, std::shared_ptr<Node<T>> nodeB);
 
+        /**
+         * @brief Copy constructor of a channel, which copies the line segments and arcs.
+         * @param[in] channel The channel that is copied.
+        */
+        Channel(const Channel<T>& channel);
+
         /**
          * @brief Set length of channel.
          * @param[in] length New length of this channel in m.
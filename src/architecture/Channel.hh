@@ -86,6 +86,19 @@ namespace arch {
         }
     }
 
+    template<typename T>
+    Channel<T>::Channel(const Channel<T>& channel) :
+    Edge<T>(channel), length(channel.length), area(channel.area), pressure(channel.pressure),
+    channelResistance(channel.channelResistance), dropletResistance(channel.dropletResistance),
+    shape(channel.shape), type(channel.type) {
+        for (auto& line : channel.line_segments) {
+            line_segments.push_back(std::make_unique<Line_segment<T,2>>(*line));
+        }
+        for (auto& arc : channel.arcs) {
+            arcs.push_back(std::make_unique<Arc<T,2>>(*arc));
+        }
+    }
+
     template<typename T>
     void Channel<T>::setLength(T length_) {
         this->length = length_;
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <queue>
 #include <set>
+#include <thread>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
@@ -67,7 +70,7 @@ struct Group {
      * @param[in] channelIds Ids of the channels that constitute this group.
     */
     Group(int groupId_, std::unordered_set<int> nodeIds_, std::unordered_set<int> channelIds_, Network<T>* network_) :
-        groupId(groupId_), nodeIds(nodeIds_), channelIds(channelIds_) {
+        groupId(groupId_), nodeIds(std::move(nodeIds_)), channelIds(std::move(channelIds_)) {
         for (auto& nodeId : nodeIds) {
             if (network_->getNode(nodeId)->getGround()) {
                 grounded = true;
@@ -76,6 +79,55 @@ struct Group {
     }
 };
 
+/**
+ * @brief A struct that defines a frozen, contiguous compressed sparse row (CSR) view of the channels of a network.
+ * Nodes are stored with a dense index in ascending order of their ids, the channels adjacent to a node are stored
+ * consecutively between offsets[i] and offsets[i+1]. The edges are stored in the iteration order of the channels of the network.
+*/
+template<typename T>
+struct NetworkCSR {
+
+    bool valid = false;                                 ///< Is the view up to date with the topology of the network?
+    std::vector<int> nodeIds;                           ///< Id of the node at each dense node index.
+    std::vector<int> nodeIndex;                         ///< Dense node index of each node id, -1 if the id is not in use.
+    std::vector<int> offsets;                           ///< Offsets into the adjacency arrays per dense node index (size nNodes+1).
+    std::vector<int> adjacentEdges;                     ///< Edge indices of the channels adjacent to the nodes.
+    std::vector<RectangularChannel<T>*> adjacentChannels;   ///< Pointers to the channels adjacent to the nodes.
+    std::vector<int> edgeIds;                           ///< Id of the channel at each edge index.
+    std::vector<int> edgeIndex;                         ///< Edge index of each channel id, -1 if the id is not in use.
+    std::vector<int> nodeA;                             ///< Dense node index of node A of each edge.
+    std::vector<int> nodeB;                             ///< Dense node index of node B of each edge.
+    std::vector<RectangularChannel<T>*> channels;       ///< Pointer to the channel of each edge.
+
+    /**
+     * @brief Get the number of nodes in the view.
+     * @returns Number of nodes.
+    */
+    int nNodes() const { return nodeIds.size(); }
+
+    /**
+     * @brief Get the number of edges in the view.
+     * @returns Number of edges.
+    */
+    int nEdges() const { return edgeIds.size(); }
+};
+
+/**
+ * @brief A non-owning range over the channels adjacent to a node, backed by the adjacency arrays of the CSR view.
+ * The range is invalidated when the topology of the network changes.
+*/
+template<typename T>
+struct ChannelRange {
+
+    RectangularChannel<T>* const* first = nullptr;    ///< Pointer to the first channel in the range.
+    RectangularChannel<T>* const* last = nullptr;     ///< Pointer past the last channel in the range.
+
+    RectangularChannel<T>* const* begin() const { return first; }
+    RectangularChannel<T>* const* end() const { return last; }
+    std::size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+};
+
 /**
  * @brief Class to specify a Network of Nodes, Channels, and Models for a Platform on a Chip.
 */
@@ -93,15 +145,14 @@ private:
     std::unordered_map<int, std::unordered_map<int, RectangularChannel<T>*>> reach; ///< Set of nodes and corresponding channels (reach) at these nodes in the network.
     std::unordered_map<int, Module<T>*> modularReach;                        ///< Set of nodes with corresponding module (or none) at these nodes in the network.
 
+    NetworkCSR<T> csr;                                                          ///< Frozen CSR view of the channels in the network, built by freeze().
+
     int virtualNodes = 0;
 
     /**
-     * @brief Goes through network and sets all nodes and channels that are visited to true.
-     * @param[in] id Id of the node that is visited.
-     * @param[in, out] visitedNodes Reference to a map that stores which nodes have already been visited.
-     * @param[in, out] visitedChannels Reference to a map that stores which channels have already been visited.
+     * @brief Builds the CSR view from the current nodes and channels of the network.
      */
-    void visitNodes(int id, std::unordered_map<int, bool>& visitedNodes, std::unordered_map<int, bool>& visitedChannels, std::unordered_map<int, bool>& visitedModules);
+    void buildCSR();
     
 public:
     /**
@@ -145,6 +196,13 @@ public:
     */
     Network();
 
+    /**
+     * @brief Create a deep copy of the nodes, channels and pumps of the network, e.g., to simulate variants of a network
+     * concurrently. The groups are not copied and have to be sorted again. Networks with modules cannot be cloned.
+     * @returns The copy of the network.
+    */
+    Network<T> clone() const;
+
     /**
      * @brief Adds a new node to the network.
     */
@@ -369,11 +427,25 @@ public:
     const std::unordered_map<int, std::unique_ptr<RectangularChannel<T>>>& getChannels() const;
 
     /**
-     * @brief Get a map of all channels at a specific node.
+     * @brief Get a map of all channels at a specific node. Uses the CSR view if the network is frozen.
      * @param[in] nodeId Id of the node at which the adherent channels should be returned.
      * @return Vector of pointers to channels adherent to this node.
      */
     const std::vector<RectangularChannel<T>*> getChannelsAtNode(int nodeId) const;
+
+    /**
+     * @brief Get the channels at a specific node without allocating. Requires a frozen network.
+     * @param[in] nodeId Id of the node at which the adherent channels should be returned.
+     * @return Range of pointers to channels adherent to this node.
+     */
+    ChannelRange<T> getAdjacentChannels(int nodeId) const;
+
+    /**
+     * @brief Get the channels at a specific node without allocating, the network is frozen if it is not frozen.
+     * @param[in] nodeId Id of the node at which the adherent channels should be returned.
+     * @return Range of pointers to channels adherent to this node.
+     */
+    ChannelRange<T> getAdjacentChannels(int nodeId);
         
     /**
      * @brief Get the flow rate pumps of the network.
@@ -410,15 +482,37 @@ public:
     void toJson(std::string jsonString) const;
 
     /**
-     * @brief Sorts the nodes and channels into detached abstract domain groups
+     * @brief Builds the CSR view of the network. Should be called once the topology of the network is finalized.
+     * Adding nodes or channels, or turning channels into pumps, invalidates the view.
+    */
+    void freeze();
+
+    /**
+     * @brief Checks if the CSR view of the network is up to date.
+     * @return If the network is frozen.
+    */
+    bool isFrozen() const;
+
+    /**
+     * @brief Get the CSR view of the network. Requires a frozen network, the view is never rebuilt by this function,
+     * such that it can be read concurrently.
+     * @returns CSR view of the network.
+    */
+    const NetworkCSR<T>& getCSR() const;
+
+    /**
+     * @brief Sorts the nodes and channels into detached abstract domain groups. Freezes the network if it is not frozen.
     */
     void sortGroups();
 
     /**
      * @brief Checks if chip network is valid.
+     * The degree of the nodes is counted in one sweep over the channels and pumps, and the connectivity to ground
+     * is checked with a breadth-first search, i.e., the check runs in O(N+E). Freezes the network if it is not frozen.
+     * @param[in] nThreads Number of threads that check the channels and nodes, 0 uses all hardware threads.
      * @return If the network is valid.
      */
-    bool isNetworkValid();
+    bool isNetworkValid(unsigned int nThreads=1);
 
     /**
      * @brief Prints the contents of this network
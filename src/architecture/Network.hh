@@ -152,29 +152,46 @@ template<typename T>
 Network<T>::Network() { }
 
 template<typename T>
-void Network<T>::visitNodes(int id, std::unordered_map<int, bool>& visitedNodes, std::unordered_map<int, bool>& visitedChannels, std::unordered_map<int, bool>& visitedModules) {
-    const auto net = reach.at(id);
-    visitedNodes.at(id) = true;
-    for (auto [key, channel] : net) {
-        if (!(channel->getChannelType() == ChannelType::CLOGGABLE)) {
-            if (visitedChannels.at(channel->getId()) == false) {
-                visitedChannels.at(channel->getId()) = true;
-                if (channel->getNodeA() != id) {
-                    visitNodes(channel->getNodeA(), visitedNodes, visitedChannels, visitedModules);
-                } else {
-                    visitNodes(channel->getNodeB(), visitedNodes, visitedChannels, visitedModules);
-                }
-            }
+Network<T> Network<T>::clone() const {
+    if (!modules.empty()) {
+        throw std::invalid_argument("Networks with modules cannot be cloned.");
+    }
+    // nodes and edges are inserted in ascending order of their ids, like the JSON readers do, such that the maps of the
+    // copy are iterated in the same order and the copy is simulated with the same round-off as a freshly built network
+    auto sortedIds = [](const auto& map) {
+        std::vector<int> ids;
+        for (auto& [id, value] : map) {
+            ids.push_back(id);
         }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
+    Network<T> network;
+    for (int nodeId : sortedIds(nodes)) {
+        network.nodes.try_emplace(nodeId, std::make_shared<Node<T>>(*nodes.at(nodeId)));
+        network.reach.try_emplace(nodeId);
     }
-    if (modularReach.count(id)) {
-        if(visitedModules.at(modularReach.at(id)->getId()) == false) {
-            visitedModules.at(modularReach.at(id)->getId()) = true;
-            for (auto& [k, node] : modularReach.at(id)->getNodes()) {
-                visitNodes(node->getId(), visitedNodes, visitedChannels, visitedModules);
-            }
-        }
+    for (auto* sink : sinks) {
+        network.sinks.emplace(network.nodes.at(sink->getId()).get());
+    }
+    for (auto* groundNode : groundNodes) {
+        network.groundNodes.emplace(network.nodes.at(groundNode->getId()).get());
+    }
+    for (int channelId : sortedIds(channels)) {
+        auto addChannel = new RectangularChannel<T>(*channels.at(channelId));
+        network.reach.at(addChannel->getNodeA()).try_emplace(channelId, addChannel);
+        network.reach.at(addChannel->getNodeB()).try_emplace(channelId, addChannel);
+        network.channels.try_emplace(channelId, addChannel);
     }
+    for (int pumpId : sortedIds(flowRatePumps)) {
+        network.flowRatePumps.try_emplace(pumpId, std::make_unique<FlowRatePump<T>>(*flowRatePumps.at(pumpId)));
+    }
+    for (int pumpId : sortedIds(pressurePumps)) {
+        network.pressurePumps.try_emplace(pumpId, std::make_unique<PressurePump<T>>(*pressurePumps.at(pumpId)));
+    }
+    network.virtualNodes = virtualNodes;
+    return network;
 }
 
 template<typename T>
@@ -184,6 +201,7 @@ Node<T>* Network<T>::addNode(T x_, T y_, bool ground_) {
 
     if (result.second) {
         // insertion happened and we have to add an additional entry into the reach
+        csr.valid = false;
         reach.insert_or_assign(nodeId, std::unordered_map<int, RectangularChannel<T>*>{});
     } else {
         std::out_of_range(  "Could not add Node " + std::to_string(nodeId) + " at (" + std::to_string(x_) +
@@ -204,6 +222,7 @@ Node<T>* Network<T>::addNode(int nodeId, T x_, T y_, bool ground_) {
 
     if (result.second) {
         // insertion happened and we have to add an additional entry into the reach
+        csr.valid = false;
         reach.insert_or_assign(nodeId, std::unordered_map<int, RectangularChannel<T>*>{});
     } else {
         std::out_of_range(  "Could not add Node " + std::to_string(nodeId) + " at (" + std::to_string(x_) +
@@ -234,6 +253,7 @@ RectangularChannel<T>* Network<T>::addChannel(int nodeAId, int nodeBId, T height
 
     // add channel
     channels.try_emplace(id, addChannel);
+    csr.valid = false;
 
     return addChannel;
 }
@@ -253,6 +273,7 @@ RectangularChannel<T>* Network<T>::addChannel(int nodeAId, int nodeBId, T height
 
     // add channel
     channels.try_emplace(channelId, addChannel);
+    csr.valid = false;
 
     return addChannel;
 }
@@ -274,6 +295,7 @@ RectangularChannel<T>* Network<T>::addChannel(int nodeAId, int nodeBId, T height
 
     // add channel
     channels.try_emplace(id, addChannel);
+    csr.valid = false;
 
     return addChannel;
 }
@@ -295,6 +317,7 @@ RectangularChannel<T>* Network<T>::addChannel(int nodeAId, int nodeBId, T resist
 
     // add channel
     channels.try_emplace(id, addChannel);
+    csr.valid = false;
 
     return addChannel;
 }
@@ -399,6 +422,7 @@ void Network<T>::setPressurePump(int channelId_, T pressure_) {
     channels.erase(channelId_);
     reach.at(nodeAId).erase(channelId_);
     reach.at(nodeBId).erase(channelId_);
+    csr.valid = false;
 }
 
 template<typename T>
@@ -410,6 +434,7 @@ void Network<T>::setFlowRatePump(int channelId_, T flowRate_) {
     channels.erase(channelId_);
     reach.at(nodeAId).erase(channelId_);
     reach.at(nodeBId).erase(channelId_);
+    csr.valid = false;
 }
 
 template<typename T>
@@ -502,6 +527,10 @@ const std::unordered_map<int, std::unique_ptr<RectangularChannel<T>>>& Network<T
 
 template<typename T>
 const std::vector<RectangularChannel<T>*> Network<T>::getChannelsAtNode(int nodeId_) const {
+    if (csr.valid) {
+        auto channelRange = getAdjacentChannels(nodeId_);
+        return std::vector<RectangularChannel<T>*>(channelRange.begin(), channelRange.end());
+    }
     try {
         std::vector<RectangularChannel<T>*> tmp;
         for (auto& [key, channel] : reach.at(nodeId_)) {
@@ -513,6 +542,25 @@ const std::vector<RectangularChannel<T>*> Network<T>::getChannelsAtNode(int node
     }
 }
 
+template<typename T>
+ChannelRange<T> Network<T>::getAdjacentChannels(int nodeId_) const {
+    const auto& view = getCSR();
+    if (nodeId_ < 0 || nodeId_ >= static_cast<int>(view.nodeIndex.size()) || view.nodeIndex[nodeId_] < 0) {
+        throw std::invalid_argument("Node with ID " + std::to_string(nodeId_) + " does not exist.");
+    }
+    const int index = view.nodeIndex[nodeId_];
+    const auto data = view.adjacentChannels.data();
+    return ChannelRange<T> { data + view.offsets[index], data + view.offsets[index + 1] };
+}
+
+template<typename T>
+ChannelRange<T> Network<T>::getAdjacentChannels(int nodeId_) {
+    if (!csr.valid) {
+        freeze();
+    }
+    return static_cast<const Network<T>*>(this)->getAdjacentChannels(nodeId_);
+}
+
 template<typename T>
 const std::unordered_map<int, std::unique_ptr<FlowRatePump<T>>>& Network<T>::getFlowRatePumps() const {
     return flowRatePumps;
@@ -539,78 +587,131 @@ const std::unordered_map<int, std::unique_ptr<Group<T>>>& Network<T>::getGroups(
 }
 
 template<typename T>
-void Network<T>::sortGroups() {
-    std::vector<int> nodeVector;
-    std::vector<Edge<T>*> edges;
-    int groupId = 0;
+void Network<T>::freeze() {
+    buildCSR();
+}
+
+template<typename T>
+void Network<T>::buildCSR() {
+    csr = NetworkCSR<T>();
+
+    // dense node index in ascending order of the node ids
+    int maxNodeId = -1;
     for (auto& [key, node] : nodes) {
-        nodeVector.emplace_back(key);
+        maxNodeId = std::max(maxNodeId, key);
+    }
+    csr.nodeIndex.assign(maxNodeId + 1, -1);
+    for (int nodeId = 0; nodeId <= maxNodeId; ++nodeId) {
+        if (nodes.count(nodeId)) {
+            csr.nodeIndex[nodeId] = csr.nodeIds.size();
+            csr.nodeIds.push_back(nodeId);
+        }
     }
+
+    // edge arrays
+    const int nEdges = channels.size();
+    csr.edgeIds.reserve(nEdges);
+    csr.nodeA.reserve(nEdges);
+    csr.nodeB.reserve(nEdges);
+    csr.channels.reserve(nEdges);
     for (auto& [key, channel] : channels) {
-        edges.emplace_back(channel.get());
+        csr.edgeIds.push_back(key);
+        csr.nodeA.push_back(csr.nodeIndex.at(channel->getNodeA()));
+        csr.nodeB.push_back(csr.nodeIndex.at(channel->getNodeB()));
+        csr.channels.push_back(channel.get());
+    }
+    int maxChannelId = -1;
+    for (int channelId : csr.edgeIds) {
+        maxChannelId = std::max(maxChannelId, channelId);
+    }
+    csr.edgeIndex.assign(maxChannelId + 1, -1);
+    for (int e = 0; e < nEdges; ++e) {
+        csr.edgeIndex[csr.edgeIds[e]] = e;
+    }
+
+    // count the degree of each node and build the offsets
+    csr.offsets.assign(csr.nNodes() + 1, 0);
+    for (int e = 0; e < nEdges; ++e) {
+        csr.offsets[csr.nodeA[e] + 1]++;
+        if (csr.nodeB[e] != csr.nodeA[e]) {
+            csr.offsets[csr.nodeB[e] + 1]++;
+        }
     }
-    /*
-    for (auto& [key, pump] : pressurePumps) {
-        edges.emplace_back(pump.get());
+    for (int i = 0; i < csr.nNodes(); ++i) {
+        csr.offsets[i + 1] += csr.offsets[i];
+    }
+
+    // fill the adjacency arrays
+    std::vector<int> fill(csr.offsets.begin(), csr.offsets.end() - 1);
+    csr.adjacentEdges.resize(csr.offsets.back());
+    csr.adjacentChannels.resize(csr.offsets.back());
+    for (int e = 0; e < nEdges; ++e) {
+        csr.adjacentEdges[fill[csr.nodeA[e]]] = e;
+        csr.adjacentChannels[fill[csr.nodeA[e]]++] = csr.channels[e];
+        if (csr.nodeB[e] != csr.nodeA[e]) {
+            csr.adjacentEdges[fill[csr.nodeB[e]]] = e;
+            csr.adjacentChannels[fill[csr.nodeB[e]]++] = csr.channels[e];
+        }
+    }
+
+    csr.valid = true;
+}
+
+template<typename T>
+bool Network<T>::isFrozen() const {
+    return csr.valid;
+}
+
+template<typename T>
+const NetworkCSR<T>& Network<T>::getCSR() const {
+    if (!csr.valid) {
+        throw std::runtime_error("The CSR view of the network is not up to date. Please freeze the network after changing its topology.");
     }
-    for (auto& [key, pump] : flowRatePumps) {
-        edges.emplace_back(pump.get());
+    return csr;
+}
+
+template<typename T>
+void Network<T>::sortGroups() {
+    if (!csr.valid) {
+        freeze();
     }
-    */
-    while(!nodeVector.empty()){
-        std::queue<int> connectedNodes;
+
+    // Breadth-first search over the adjacency of the CSR view, every node and channel is visited once.
+    // Only channels connect the nodes of a group, pumps do not.
+    const auto& view = csr;
+    std::vector<bool> visitedNodes(view.nNodes(), false);
+    std::vector<bool> visitedEdges(view.nEdges(), false);
+    std::queue<int> connectedNodes;
+    int groupId = 0;
+
+    for (auto& [key, node] : nodes) {
+        const int start = view.nodeIndex[key];
+        if (visitedNodes[start]) {
+            continue;
+        }
+
         std::unordered_set<int> nodeIds;
         std::unordered_set<int> edgeIds;
-        auto p = nodeIds.insert(nodeVector.front());
-
-        if (p.second) {
-            for (auto& edge : edges) {
-                if (edge->getNodeA() == nodeVector.front()) {
-                    auto t = edgeIds.insert(edge->getId());
-                    if (t.second) {
-                        connectedNodes.push(edge->getNodeB());
-                    }
-                }
-                if (edge->getNodeB() == nodeVector.front()) {
-                    auto t = edgeIds.insert(edge->getId());
-                    if (t.second) {
-                        connectedNodes.push(edge->getNodeA());
-                    }
-                }
-            }
-            for (long unsigned int i=0; i < nodeVector.size(); i++) {
-                if (nodeVector[i] == nodeVector.front()) {
-                    nodeVector.erase(nodeVector.begin() + i);
-                }
+        connectedNodes.push(start);
+        while (!connectedNodes.empty()) {
+            const int current = connectedNodes.front();
+            connectedNodes.pop();
+            if (visitedNodes[current]) {
+                continue;
             }
-        }
-        while(!connectedNodes.empty()) {
-            auto q = nodeIds.insert(connectedNodes.front());
-            if (q.second) {
-                for (auto& edge : edges) {
-                    if (edge->getNodeA() == connectedNodes.front()) {
-                        auto t = edgeIds.insert(edge->getId());
-                        if (t.second) {
-                            connectedNodes.push(edge->getNodeB());
-                        }
-                    }
-                    if (edge->getNodeB() == connectedNodes.front()) {
-                        auto t = edgeIds.insert(edge->getId());
-                        if (t.second) {
-                            connectedNodes.push(edge->getNodeA());
-                        }
-                    }
-                }
-                for (long unsigned int i=0; i < nodeVector.size(); i++) {
-                    if (nodeVector[i] == connectedNodes.front()) {
-                        nodeVector.erase(nodeVector.begin() + i);
-                    }
+            visitedNodes[current] = true;
+            nodeIds.insert(view.nodeIds[current]);
+            for (int i = view.offsets[current]; i < view.offsets[current + 1]; ++i) {
+                const int edge = view.adjacentEdges[i];
+                if (!visitedEdges[edge]) {
+                    visitedEdges[edge] = true;
+                    edgeIds.insert(view.edgeIds[edge]);
+                    connectedNodes.push(view.nodeA[edge] != current ? view.nodeA[edge] : view.nodeB[edge]);
                 }
             }
-            connectedNodes.pop();
         }
 
-        Group<T>* addGroup = new Group<T>(groupId, nodeIds, edgeIds, this);
+        Group<T>* addGroup = new Group<T>(groupId, std::move(nodeIds), std::move(edgeIds), this);
         groups.try_emplace(groupId, addGroup);
         
         groupId++;
@@ -618,73 +719,94 @@ void Network<T>::sortGroups() {
 }
 
 template<typename T>
-bool Network<T>::isNetworkValid() {
+bool Network<T>::isNetworkValid(unsigned int nThreads) {
     // checks if all nodes and channels are connected to ground (if channel network is one graph)
-    std::unordered_map<int, bool> visitedNodes;
-    std::unordered_map<int, bool> visitedEdges;
-    std::unordered_map<int, bool> visitedModules;
-
-    std::unordered_map<int, Edge<T>*> edges;
-
-    for (auto& [key, channel] : channels) {
-        edges.try_emplace(key, channel.get());
-    }
-    /*
-    for (auto& [key, pump] : pressurePumps) {
-        edges.try_emplace(key, pump.get());
-    }
-    for (auto& [key, pump] : flowRatePumps) {
-        edges.try_emplace(key, pump.get());
-    }
-    */
     if (nodes.size() == 0) {
         throw std::invalid_argument("No nodes in network.");
     }
 
-    for (auto const& [k, v] : channels) {
-        if (v->getLength() <= 0) {
-            throw std::invalid_argument("Channel " + std::to_string(k) + ": length is <= 0.");
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Applies the function to the indices [0, n), split into contiguous chunks over nThreads threads
+    auto forRange = [nThreads](int n, const auto& function) {
+        const int nChunks = std::min<int>(nThreads, std::max(n, 1));
+        if (nChunks <= 1) {
+            for (int i = 0; i < n; ++i) {
+                function(i);
+            }
+            return;
         }
-        if (v->getHeight() <= 0) {
-            throw std::invalid_argument("Channel " + std::to_string(k) + ": height is <= 0.");
+        std::vector<std::thread> threads;
+        threads.reserve(nChunks);
+        for (int chunk = 0; chunk < nChunks; ++chunk) {
+            threads.emplace_back([&, chunk]() {
+                const int end = (static_cast<long>(n) * (chunk + 1)) / nChunks;
+                for (int i = (static_cast<long>(n) * chunk) / nChunks; i < end; ++i) {
+                    function(i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
         }
-        if (v->getWidth() <= 0) {
-            throw std::invalid_argument("Channel " + std::to_string(k) + ": width is <= 0.");
+    };
+
+    if (!csr.valid) {
+        freeze();
+    }
+    const auto& view = csr;
+
+    // check the channel dimensions, the first invalid channel (in iteration order) is reported
+    std::vector<char> invalidChannels(view.nEdges(), 0);
+    forRange(view.nEdges(), [&](int e) {
+        const auto channel = view.channels[e];
+        invalidChannels[e] = channel->getLength() <= 0 || channel->getHeight() <= 0 || channel->getWidth() <= 0;
+    });
+    for (int e = 0; e < view.nEdges(); ++e) {
+        if (invalidChannels[e]) {
+            const auto channel = view.channels[e];
+            const std::string id = std::to_string(view.edgeIds[e]);
+            if (channel->getLength() <= 0) {
+                throw std::invalid_argument("Channel " + id + ": length is <= 0.");
+            }
+            if (channel->getHeight() <= 0) {
+                throw std::invalid_argument("Channel " + id + ": height is <= 0.");
+            }
+            throw std::invalid_argument("Channel " + id + ": width is <= 0.");
         }
     }
 
-    for (auto const& [k, v] : nodes) {
-        visitedNodes[k] = false;
-    }
-    for (auto const& [k, v] : edges) {
-        visitedEdges[k] = false;
+    // degree of each node, i.e., the number of adjacent channels, pumps and modules, in one sweep over the pumps
+    std::vector<int> pumpDegree(view.nNodes(), 0);
+    auto countPump = [&](int nodeId) {
+        if (nodeId >= 0 && nodeId < static_cast<int>(view.nodeIndex.size()) && view.nodeIndex[nodeId] >= 0) {
+            pumpDegree[view.nodeIndex[nodeId]]++;
+        }
+    };
+    for (auto const& [key, pump] : pressurePumps) {
+        countPump(pump->getNodeA());
+        countPump(pump->getNodeB());
     }
-    for (auto const& [k, v] : modules) {
-        visitedModules[k] = false;
+    for (auto const& [key, pump] : flowRatePumps) {
+        countPump(pump->getNodeA());
+        countPump(pump->getNodeB());
     }
 
-    for (auto& node : groundNodes) {
-        visitNodes(node->getId(), visitedNodes, visitedEdges, visitedModules);
-    }
+    std::vector<char> danglingNodes(view.nNodes(), 0);
+    forRange(view.nNodes(), [&](int i) {
+        const int nodeId = view.nodeIds[i];
+        int connections = view.offsets[i + 1] - view.offsets[i] + pumpDegree[i];
+        if (modularReach.count(nodeId)) {
+            connections += 1;
+        }
+        danglingNodes[i] = connections <= 1 && !nodes.at(nodeId)->getGround();
+    });
 
     std::string errorNodes = "";
     for (auto const& [k, v] : nodes) {
-        const auto net = reach.at(k);
-        int connections = net.size();
-        for (auto const& [key, pump] : pressurePumps) {
-            if (pump->getNodeA() == k || pump->getNodeB() == k) {
-                connections += 1;
-            }
-        }
-        for (auto const& [key, pump] : flowRatePumps) {
-            if (pump->getNodeA() == k || pump->getNodeB() == k) {
-                connections += 1;
-            }
-        }
-        if (modularReach.count(k)) {
-            connections += 1;
-        }
-        if (connections <= 1 && !v->getGround()) {
+        if (danglingNodes[view.nodeIndex[k]]) {
             errorNodes.append(" " + std::to_string(k));
         }
     }
@@ -694,15 +816,52 @@ bool Network<T>::isNetworkValid() {
         return false;
     }
 
+    // breadth-first search from the ground nodes, cloggable channels do not connect nodes
+    std::vector<char> visitedNodes(view.nNodes(), 0);
+    std::vector<char> visitedEdges(view.nEdges(), 0);
+    std::unordered_map<int, bool> visitedModules;
+    for (auto const& [k, v] : modules) {
+        visitedModules[k] = false;
+    }
+
+    std::queue<int> connectedNodes;
+    auto visit = [&](int index) {
+        if (!visitedNodes[index]) {
+            visitedNodes[index] = true;
+            connectedNodes.push(index);
+        }
+    };
+    for (auto& node : groundNodes) {
+        visit(view.nodeIndex.at(node->getId()));
+    }
+    while (!connectedNodes.empty()) {
+        const int current = connectedNodes.front();
+        connectedNodes.pop();
+        for (int i = view.offsets[current]; i < view.offsets[current + 1]; ++i) {
+            const int edge = view.adjacentEdges[i];
+            if (view.channels[edge]->getChannelType() != ChannelType::CLOGGABLE && !visitedEdges[edge]) {
+                visitedEdges[edge] = true;
+                visit(view.nodeA[edge] != current ? view.nodeA[edge] : view.nodeB[edge]);
+            }
+        }
+        const int nodeId = view.nodeIds[current];
+        if (modularReach.count(nodeId) && !visitedModules.at(modularReach.at(nodeId)->getId())) {
+            visitedModules.at(modularReach.at(nodeId)->getId()) = true;
+            for (auto& [k, node] : modularReach.at(nodeId)->getNodes()) {
+                visit(view.nodeIndex.at(node->getId()));
+            }
+        }
+    }
+
     for (auto const& [k, v] : nodes) {
-        if (visitedNodes[k] == false) {
+        if (!visitedNodes[view.nodeIndex[k]]) {
             errorNodes.append(" " + std::to_string(k));
         }
     }
     std::string errorEdges = "";
-    for (auto const& [k, v] : edges) {
-        if (visitedEdges[k] == false) {
-            errorEdges.append(" " + std::to_string(k));
+    for (int e = 0; e < view.nEdges(); ++e) {
+        if (!visitedEdges[e]) {
+            errorEdges.append(" " + std::to_string(view.edgeIds[e]));
         }
     }
     std::string errorModules = "";
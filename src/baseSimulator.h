@@ -3,11 +3,13 @@
  */
 #pragma once
 
+#include "simulation/AsyncWriter.h"
 #include "simulation/CFDSim.h"
 #include "simulation/Droplet.h"
 #include "simulation/Fluid.h"
 #include "simulation/Injection.h"
 #include "simulation/MembraneModels.h"
+#include "simulation/MemoryPool.h"
 #include "simulation/Mixture.h"
 #include "simulation/MixtureInjection.h"
 #include "simulation/MixingModels.h"
@@ -18,9 +20,11 @@
 #include "simulation/simulators/olbMixing.h"
 #include "simulation/simulators/olbOoc.h"
 #include "simulation/Specie.h"
+#include "simulation/ThreadPool.h"
 #include "simulation/Tissue.h"
 #include "simulation/events/BoundaryEvent.h"
 #include "simulation/events/Event.h"
+#include "simulation/events/EventScheduler.h"
 #include "simulation/events/InjectionEvent.h"
 #include "simulation/events/MergingEvent.h"
 
@@ -28,6 +32,7 @@
 
 #include "hybridDynamics/Scheme.h"
 #include "hybridDynamics/Naive.h"
+#include "hybridDynamics/Aitken.h"
 
 #include "architecture/Channel.h"
 #include "architecture/ChannelPosition.h"
@@ -43,9 +48,13 @@
 #include "olbProcessors/saturatedFluxPostProcessor2D.h"
 #include "olbProcessors/setFunctionalRegularizedHeatFlux.h"
 
+#include "porting/binaryPorter.h"
 #include "porting/jsonPorter.h"
 #include "porting/jsonReaders.h"
 #include "porting/jsonWriters.h"
+#include "porting/networkGenerator.h"
+#include "porting/parameterSweep.h"
+#include "porting/stateSinks.h"
 
 #include "result/Results.h"
 
@@ -1,8 +1,10 @@
+#include "simulation/AsyncWriter.hh"
 #include "simulation/CFDSim.hh"
 #include "simulation/Droplet.hh"
 #include "simulation/Fluid.hh"
 #include "simulation/Injection.hh"
 #include "simulation/MembraneModels.hh"
+#include "simulation/MemoryPool.hh"
 #include "simulation/Mixture.hh"
 #include "simulation/MixtureInjection.hh"
 #include "simulation/MixingModels.hh"
@@ -13,8 +15,10 @@
 #include "simulation/simulators/olbMixing.hh"
 #include "simulation/simulators/olbOoc.hh"
 #include "simulation/Specie.hh"
+#include "simulation/ThreadPool.hh"
 #include "simulation/Tissue.hh"
 #include "simulation/events/BoundaryEvent.hh"
+#include "simulation/events/EventScheduler.hh"
 #include "simulation/events/InjectionEvent.hh"
 #include "simulation/events/MergingEvent.hh"
 
@@ -22,6 +26,7 @@
 
 #include "hybridDynamics/Scheme.hh"
 #include "hybridDynamics/Naive.hh"
+#include "hybridDynamics/Aitken.hh"
 
 #include "architecture/Channel.hh"
 #include "architecture/ChannelPosition.hh"
@@ -36,9 +41,13 @@
 #include "olbProcessors/saturatedFluxPostProcessor2D.hh"
 #include "olbProcessors/setFunctionalRegularizedHeatFlux.hh"
 
+#include "porting/binaryPorter.hh"
 #include "porting/jsonPorter.hh"
 #include "porting/jsonReaders.hh"
 #include "porting/jsonWriters.hh"
+#include "porting/networkGenerator.hh"
+#include "porting/parameterSweep.hh"
+#include "porting/stateSinks.hh"
 
 #include "result/Results.hh"
 
@@ -0,0 +1,117 @@
+/**
+ * @file Aitken.h
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace arch {
+
+// Forward declared dependencies
+template<typename T>
+class Module;
+
+}
+
+namespace mmft{
+
+/**
+ * @brief The Aitken Scheme is an update scheme that accelerates the fixed-point iteration on the Abstract-CFD interface
+ * with Aitken's dynamic relaxation. The relaxation factor of a module is recomputed in every coupling iteration from the
+ * change of the interface residual, separately for pressures and flow rates. The provided alpha and beta are only used
+ * for the first iteration. Additionally, the amount of LBM iterations between updates, theta, is adapted to the
+ * convergence rate of the interface residual: it is doubled when the residual stagnates and halved when it decreases fast.
+ */
+template<typename T>
+class AitkenScheme : public Scheme<T> {
+
+private:
+
+    /**
+     * @brief The history of the Aitken relaxation of one interface quantity of a module.
+     */
+    struct Relaxation {
+        std::unordered_map<int, T> residual;    ///< Residual of the previous coupling iteration. <nodeId, residual>
+        T omega = 0.0;                          ///< Relaxation factor of the previous coupling iteration.
+        bool valid = false;                     ///< Whether the history can be used for the next iteration.
+    };
+
+    std::unordered_map<int, Relaxation> pressureRelaxations;    // Aitken history of the pressure updates <moduleId, relaxation>
+    std::unordered_map<int, Relaxation> flowRateRelaxations;    // Aitken history of the flow rate updates <moduleId, relaxation>
+    std::unordered_map<int, T> residuals;                       // Relative interface residual of the previous iteration <moduleId, residual>
+
+    T omegaMin = 0.01;              // Lower bound of the relaxation factor
+    T omegaMax = 2.0;               // Upper bound of the relaxation factor
+    int thetaMin = 1;               // Lower bound of the amount of LBM iterations between updates
+    int thetaMax = 1;               // Upper bound of the amount of LBM iterations between updates
+    T stagnationRatio = 0.9;        // Residual ratio above which theta is increased
+    T convergenceRatio = 0.5;       // Residual ratio below which theta is decreased
+
+    /**
+     * @brief Relaxes the values of one interface quantity of a module with Aitken's dynamic relaxation factor.
+     * @param[in,out] relaxation The Aitken history of the quantity.
+     * @param[in] initialRelaxation The relaxation values that are used when no history is available. <nodeId, relaxation>
+     * @param[in] oldValues The values of the previous coupling iteration. <nodeId, value>
+     * @param[in,out] values The values of the nodal analysis, overwritten with the values that are to be set. <nodeId, value>
+     * @returns The residual norm relative to the norm of the values.
+     */
+    T relax(Relaxation& relaxation, const std::unordered_map<int, T>& initialRelaxation,
+            const std::unordered_map<int, T>& oldValues, std::unordered_map<int, T>& values);
+
+    /**
+     * @brief Adapts the amount of LBM iterations between updates of a module to the convergence of its interface residual.
+     * @param[in] moduleId The id of the module.
+     * @param[in] residual The relative interface residual of the current coupling iteration.
+     */
+    void adaptTheta(int moduleId, T residual);
+
+public:
+    /**
+     * @brief Constructor of the Aitken Scheme with provided constants.
+     * @param[in] modules The map of modules with boundary nodes upon which this scheme acts.
+     * @param[in] alpha The initial relaxation value for the pressure value update.
+     * @param[in] beta The initial relaxation value of the flow rate value update.
+     * @param[in] theta The initial amount of LBM stream and collide cycles between updates for a module.
+     */
+    AitkenScheme(const std::unordered_map<int, std::shared_ptr<arch::Module<T>>>& modules, T alpha, T beta, int theta);
+
+    /**
+     * @brief Constructor of the Aitken Scheme with provided constants.
+     * @param[in] module The module with boundary nodes upon which this scheme acts.
+     * @param[in] alpha The initial relaxation value for the pressure value update.
+     * @param[in] beta The initial relaxation value of the flow rate value update.
+     * @param[in] theta The initial amount of LBM stream and collide cycles between updates for the module.
+     */
+    AitkenScheme(const std::shared_ptr<arch::Module<T>> module, T alpha, T beta, int theta);
+
+    /**
+     * @brief Relaxes the pressures and flow rates with Aitken's dynamic relaxation factor and adapts theta.
+     * @param[in] moduleId The id of the module for which the interface values are updated.
+     * @param[in] oldPressures The pressures of the previous coupling iteration. <nodeId, pressure>
+     * @param[in,out] pressures The pressures of the nodal analysis, overwritten with the pressures that are to be set. <nodeId, pressure>
+     * @param[in] oldFlowRates The flow rates of the previous coupling iteration. <nodeId, flowRate>
+     * @param[in,out] flowRates The flow rates of the nodal analysis, overwritten with the flow rates that are to be set. <nodeId, flowRate>
+     */
+    void update(int moduleId, const std::unordered_map<int, T>& oldPressures, std::unordered_map<int, T>& pressures,
+                const std::unordered_map<int, T>& oldFlowRates, std::unordered_map<int, T>& flowRates) override;
+
+    /**
+     * @brief Sets the bounds of the dynamic relaxation factor.
+     * @param[in] omegaMin The lower bound of the relaxation factor.
+     * @param[in] omegaMax The upper bound of the relaxation factor.
+     */
+    void setOmegaLimits(T omegaMin, T omegaMax);
+
+    /**
+     * @brief Sets the bounds of the adaptive amount of LBM iterations between update steps.
+     * @param[in] thetaMin The lower bound of theta.
+     * @param[in] thetaMax The upper bound of theta.
+     */
+    void setThetaLimits(int thetaMin, int thetaMax);
+
+};
+
+}   // namespace mmft
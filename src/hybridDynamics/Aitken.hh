@@ -0,0 +1,112 @@
+#include "Aitken.h"
+
+namespace mmft {
+
+template<typename T>
+AitkenScheme<T>::AitkenScheme(const std::unordered_map<int, std::shared_ptr<arch::Module<T>>>& modules, T alpha, T beta, int theta) :
+    Scheme<T>(modules, alpha, beta, theta), thetaMin(std::max(1, theta / 10)), thetaMax(std::max(1, 10 * theta)) { }
+
+template<typename T>
+AitkenScheme<T>::AitkenScheme(const std::shared_ptr<arch::Module<T>> module, T alpha, T beta, int theta) :
+    Scheme<T>(module, alpha, beta, theta), thetaMin(std::max(1, theta / 10)), thetaMax(std::max(1, 10 * theta)) { }
+
+template<typename T>
+void AitkenScheme<T>::update(int moduleId_, const std::unordered_map<int, T>& oldPressures_, std::unordered_map<int, T>& pressures_,
+                             const std::unordered_map<int, T>& oldFlowRates_, std::unordered_map<int, T>& flowRates_)
+{
+    T pressureResidual = relax(pressureRelaxations[moduleId_], this->alpha, oldPressures_, pressures_);
+    T flowRateResidual = relax(flowRateRelaxations[moduleId_], this->beta, oldFlowRates_, flowRates_);
+    adaptTheta(moduleId_, pressureResidual + flowRateResidual);
+}
+
+template<typename T>
+T AitkenScheme<T>::relax(Relaxation& relaxation_, const std::unordered_map<int, T>& initialRelaxation_,
+                         const std::unordered_map<int, T>& oldValues_, std::unordered_map<int, T>& values_)
+{
+    // Values without a positive previous value are set directly, as in the naive scheme
+    std::unordered_map<int, T> residual;
+    bool initial = false;
+    T residualNorm = 0.0;
+    T valueNorm = 0.0;
+    for (auto& [nodeId, value] : values_) {
+        T oldValue = oldValues_.at(nodeId);
+        if (oldValue > 0) {
+            residual.try_emplace(nodeId, value - oldValue);
+            residualNorm += (value - oldValue) * (value - oldValue);
+            valueNorm += value * value;
+        } else {
+            initial = true;
+        }
+    }
+
+    bool history = relaxation_.valid && !initial && relaxation_.residual.size() == residual.size();
+    for (auto& [nodeId, r] : residual) {
+        history = history && relaxation_.residual.count(nodeId);
+    }
+
+    if (history) {
+        // Aitken's dynamic relaxation: omega_k = -omega_{k-1} * r_{k-1} . (r_k - r_{k-1}) / |r_k - r_{k-1}|^2
+        T numerator = 0.0;
+        T denominator = 0.0;
+        for (auto& [nodeId, r] : residual) {
+            T oldResidual = relaxation_.residual.at(nodeId);
+            numerator += oldResidual * (r - oldResidual);
+            denominator += (r - oldResidual) * (r - oldResidual);
+        }
+        if (denominator > 0) {
+            relaxation_.omega = std::clamp(-relaxation_.omega * numerator / denominator, omegaMin, omegaMax);
+        }
+        for (auto& [nodeId, r] : residual) {
+            values_.at(nodeId) = oldValues_.at(nodeId) + relaxation_.omega * r;
+        }
+    } else {
+        // Without history, relax with the constant relaxation values and start the history from their mean
+        T omegaSum = 0.0;
+        for (auto& [nodeId, r] : residual) {
+            values_.at(nodeId) = oldValues_.at(nodeId) + initialRelaxation_.at(nodeId) * r;
+            omegaSum += initialRelaxation_.at(nodeId);
+        }
+        if (!residual.empty()) {
+            relaxation_.omega = omegaSum / residual.size();
+        }
+    }
+    relaxation_.valid = !initial && !residual.empty();
+    relaxation_.residual = std::move(residual);
+
+    return (valueNorm > 0) ? std::sqrt(residualNorm / valueNorm) : 0.0;
+}
+
+template<typename T>
+void AitkenScheme<T>::adaptTheta(int moduleId_, T residual_) {
+    auto previous = residuals.find(moduleId_);
+    auto theta = this->theta.find(moduleId_);
+    if (previous != residuals.end() && previous->second > 0 && theta != this->theta.end()) {
+        T ratio = residual_ / previous->second;
+        if (ratio > stagnationRatio) {
+            theta->second = std::min(2 * theta->second, thetaMax);
+        } else if (ratio < convergenceRatio) {
+            theta->second = std::max(theta->second / 2, thetaMin);
+        }
+    }
+    residuals.insert_or_assign(moduleId_, residual_);
+}
+
+template<typename T>
+void AitkenScheme<T>::setOmegaLimits(T omegaMin_, T omegaMax_) {
+    if (omegaMin_ <= 0 || omegaMax_ < omegaMin_) {
+        throw std::invalid_argument("The relaxation factor limits must satisfy 0 < omegaMin <= omegaMax.");
+    }
+    omegaMin = omegaMin_;
+    omegaMax = omegaMax_;
+}
+
+template<typename T>
+void AitkenScheme<T>::setThetaLimits(int thetaMin_, int thetaMax_) {
+    if (thetaMin_ < 1 || thetaMax_ < thetaMin_) {
+        throw std::invalid_argument("The theta limits must satisfy 1 <= thetaMin <= thetaMax.");
+    }
+    thetaMin = thetaMin_;
+    thetaMax = thetaMax_;
+}
+
+}   // namespace mmft
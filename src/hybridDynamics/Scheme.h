@@ -74,6 +74,24 @@ protected:
 
 public:
 
+    /**
+     * @brief Virtual default destructor of a Scheme.
+     */
+    virtual ~Scheme() = default;
+
+    /**
+     * @brief Computes the pressures and flow rates that are communicated to the CFD simulator of a module for the next
+     * coupling iteration. By default, the values are relaxed towards the result of the nodal analysis with the constant
+     * relaxation values alpha (pressures) and beta (flow rates).
+     * @param[in] moduleId The id of the module for which the interface values are updated.
+     * @param[in] oldPressures The pressures of the previous coupling iteration. <nodeId, pressure>
+     * @param[in,out] pressures The pressures of the nodal analysis, overwritten with the pressures that are to be set. <nodeId, pressure>
+     * @param[in] oldFlowRates The flow rates of the previous coupling iteration. <nodeId, flowRate>
+     * @param[in,out] flowRates The flow rates of the nodal analysis, overwritten with the flow rates that are to be set. <nodeId, flowRate>
+     */
+    virtual void update(int moduleId, const std::unordered_map<int, T>& oldPressures, std::unordered_map<int, T>& pressures,
+                        const std::unordered_map<int, T>& oldFlowRates, std::unordered_map<int, T>& flowRates);
+
     /**
      * @brief Sets the relaxation value for pressure updates for all nodes to the provided value.
      * @param[in] alpha The relaxation value for pressure updates.
@@ -38,6 +38,24 @@ Scheme<T>::Scheme(const std::shared_ptr<arch::Module<T>> module_, std::unordered
     theta.try_emplace(module_->getId(), theta_);
 }
 
+template<typename T>
+void Scheme<T>::update(int moduleId_, const std::unordered_map<int, T>& oldPressures_, std::unordered_map<int, T>& pressures_,
+                       const std::unordered_map<int, T>& oldFlowRates_, std::unordered_map<int, T>& flowRates_) 
+{
+    for (auto& [nodeId, pressure] : pressures_) {
+        T oldPressure = oldPressures_.at(nodeId);
+        if (oldPressure > 0) {
+            pressure = oldPressure + alpha.at(nodeId) * (pressure - oldPressure);
+        }
+    }
+    for (auto& [nodeId, flowRate] : flowRates_) {
+        T oldFlowRate = oldFlowRates_.at(nodeId);
+        if (oldFlowRate > 0) {
+            flowRate = oldFlowRate + beta.at(nodeId) * (flowRate - oldFlowRate);
+        }
+    }
+}
+
 template<typename T>
 void Scheme<T>::setAlpha(T alpha_) {
     for (auto& a : alpha) {
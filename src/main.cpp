@@ -14,6 +14,49 @@ using T = double;
 
 int main(int argc, char const* argv []) {
 
+    if (argc < 2) {
+        std::cout << "Usage: MMFTSim <file.JSON>\n"
+                  << "       MMFTSim --generate <grid|ladder|tree|random> <nNodes> <file.JSON> [--platform <Continuous|BigDroplet|Mixing>]\n"
+                  << "               [--mixingModel <Instantaneous|Diffusion>] [--droplets <n>] [--injections <n>] [--seed <n>]" << std::endl;
+        return 1;
+    }
+
+    // Generate a synthetic network and simulation definition and store it in a JSON file
+    if (std::string(argv[1]) == "--generate") {
+        if (argc < 5) {
+            std::cout << "[Main] --generate requires a topology, the number of nodes and an output file." << std::endl;
+            return 1;
+        }
+        porting::GeneratorSettings<T> settings;
+        settings.topology = porting::topologyFromString(argv[2]);
+        settings.nNodes = std::stoi(argv[3]);
+        for (int i = 5; i < argc; i += 2) {
+            std::string option = argv[i];
+            if (i + 1 == argc) {
+                std::cout << "[Main] Option " << option << " requires a value." << std::endl;
+                return 1;
+            }
+            if (option == "--platform") {
+                settings.platform = argv[i + 1];
+            } else if (option == "--mixingModel") {
+                settings.mixingModel = argv[i + 1];
+            } else if (option == "--droplets") {
+                settings.nDroplets = std::stoi(argv[i + 1]);
+            } else if (option == "--injections") {
+                settings.nMixtureInjections = std::stoi(argv[i + 1]);
+            } else if (option == "--seed") {
+                settings.seed = std::stoul(argv[i + 1]);
+            } else {
+                std::cout << "[Main] Unknown option " << option << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "[Main] Generate network..." << std::endl;
+        std::ofstream output(argv[4]);
+        output << porting::generateSimulation<T>(settings).dump(4) << std::endl;
+        return 0;
+    }
+
     #ifdef USE_ESSLBM
     MPI_Init(NULL,NULL);
     #endif
@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include "Eigen/Dense"
+#include "Eigen/Sparse"
 
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
@@ -31,6 +36,16 @@ class CFDSimulator;
 
 namespace nodal {
 
+/**
+ * @brief The role of a node in the system of equations of the nodal analysis.
+ */
+enum class NodeRole {
+    None,           ///< Node that is not part of any group.
+    Conducting,     ///< Node with an unknown pressure.
+    GroupGround,    ///< Node that acts as reference node of its group, its reference pressure is an additional pump row.
+    Ground          ///< Global ground node with a pressure of 0.
+};
+
 template<typename T>
 class NodalAnalysis {
 private:
@@ -41,21 +56,65 @@ private:
 
     bool pressureConvergence;
 
+    double elapsedTime = 0.0;       // Accumulated wall-clock time of all conducted nodal analyses in s
+    double assemblyTime = 0.0;      // Accumulated wall-clock time of the assembly of the system of equations in s
+
+    bool sparse = false;            // Is the system assembled and solved with the sparse backend
+    int sparseThreshold = 500;      // Minimal system size for which the sparse backend is used
+    bool reuseFactorization = false;    // Reuse the sparsity pattern and symbolic factorization of the previous solve
+    bool patternAnalyzed = false;       // Does sparseSolver hold the symbolic factorization of the pattern of sparseA
+    bool factorizationValid = false;    // Does the dense or sparse solver hold a valid factorization of the last full solve
+    bool systemAssembled = false;       // Does the system hold the complete equations of the last nodal analysis without CFD simulators
+
+    int maxIncrementalUpdates = 0;      // Maximal number of low-rank updates before the system is refactorized (0 disables updates)
+    int maxUpdateRank = 16;             // Maximal number of changed channels that is handled as a low-rank update
+    double driftTolerance = 1e-9;       // Maximal componentwise backward error of an updated solution
+    int driftCheckInterval = 4;         // Number of low-rank updates between two checks of the backward error
+    int updatesSinceFactorization = 0;  // Number of low-rank updates since the last factorization
+
     Eigen::MatrixXd A;      // matrix A = [G, B; C, D]
     Eigen::VectorXd z;      // vector z = [i; e]
     Eigen::VectorXd x;      // vector x = [v; j]
 
-    std::unordered_set<int> conductingNodeIds;
-    std::unordered_map<int, int> groundNodeIds;
+    std::vector<Eigen::Triplet<double>> triplets;                                   // entries of A for the sparse backend
+    Eigen::SparseMatrix<double> sparseA;                                            // sparse matrix A = [G, B; C, D]
+    Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> sparseSolver;
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> denseSolver;
+    std::vector<bool> occupiedRows;                                                 // rows of A that contain at least one entry
+    std::vector<int> edgeTriplets;                                                  // index of the first triplet of each CSR edge for the sparse backend
+    std::vector<int> changedRows;                                                   // rows of G that are reassembled after channel resistances changed
+    std::vector<double> factorizedConductances;                                     // edge conductances of the factorized system, indexed by CSR edge
+    std::vector<T> edgeResistances;                                                 // channel resistances of the assembled system, indexed by CSR edge
+    std::vector<T> edgeFlowRates;                                                   // channel flow rates of the last solve, indexed by CSR edge
+    std::unordered_map<int, Eigen::VectorXd> updateSolutions;                       // A^(-1) * u for the update vector u of a changed edge
+
+    std::vector<NodeRole> nodeRoles;        // role of each node, indexed by node id
+    std::vector<int> groundPumpIds;         // row of the reference pressure of each group ground node, indexed by node id
+    int nGroupGroundNodes = 0;              // number of group ground nodes
+    bool nodeRolesValid = false;            // are the node roles up to date with the groups of the network
 
     void readConductance();         // loop through channels and build matrix G
+    void updateConductance(const std::vector<int>& channelIds);   // reassemble the entries of G of the given channels
     void updateReferenceP();        // update the reference pressure for each group
     void readPressurePumps();       // loop through pressure pumps and build matrix B, C and vector e
     void readFlowRatePumps();       // loop through flowRate pumps and build vector i
-    void solve();                   // solve equation x = A^(-1) * z
+    void solve(bool incremental=false);     // solve equation x = A^(-1) * z, incrementally only after updateConductance
     void setResults();              // set pressure of nodes to v and flow rate at pressure pumps to j
     void initGroundNodes();         // initialize the ground nodes of the groups
     void clear();
+    void updateNodeRoles();         // sort nodes into conducting, group ground and ground nodes
+    void resize(int size);          // resize the system and select the dense or sparse backend
+    void addToMatrix(int row, int col, double value);    // add value to the entry (row, col) of matrix A
+    void setMatrix(int row, int col, double value);      // set the entry (row, col) of matrix A to value
+    bool solveSparse();             // solve equation x = A^(-1) * z with the sparse LU decomposition
+    bool updateSparseValues();      // write the entries into the existing pattern of the sparse matrix A
+    void pinEmptyRows();            // set x = 0 for rows of the sparse system that do not contain any entry
+    bool solveIncremental();        // update the solution of the factorized system with the changed channel conductances
+    Eigen::VectorXd solveFactorized(const Eigen::VectorXd& rhs);    // solve A^(-1) * rhs with the last factorization
+    Eigen::VectorXd updateVector(int edge);                         // vector u of a CSR edge, its conductance contributes g * u * u^T to A
+    double projectUpdate(int edge, const Eigen::VectorXd& vector);  // computes u^T * vector for the update vector u of a CSR edge
+    bool hasDrifted();              // checks the componentwise backward error of x
+    void storeFactorizedConductances();     // store the channel conductances of the newly factorized system
 
     // For hybrid simulations
     void readCfdSimulators(std::unordered_map<int, std::unique_ptr<sim::CFDSimulator<T>>>& cfdSimulators);
@@ -63,8 +122,9 @@ private:
     void initGroundNodes(std::unordered_map<int, std::unique_ptr<sim::CFDSimulator<T>>>& cfdSimulators);
 
     // Helper functions
-    bool contains( const std::unordered_set<int>& set, int key);
-    bool contains( const std::unordered_map<int,int>& map, int key);
+    bool isConducting(int nodeId) const;
+    bool isGroupGround(int nodeId) const;
+    bool isGround(int nodeId) const;
     void printSystem();
 
 public:
@@ -73,6 +133,40 @@ public:
      */
     NodalAnalysis(const arch::Network<T>* network);
 
+    /**
+     * @brief Set the minimal size of the system of equations, for which the sparse solver is used instead of the dense solver.
+     * @param[in] threshold Minimal number of unknowns (nodes, pressure pumps and group ground nodes) for the sparse solver.
+     */
+    void setSparseThreshold(int threshold);
+
+    /**
+     * @brief Returns whether the system of equations is currently solved with the sparse solver.
+     * @returns True if the sparse backend is used.
+     */
+    bool isSparse() const;
+
+    /**
+     * @brief Reuse the sparsity pattern, node ordering and symbolic factorization between consecutive nodal analyses.
+     * Only the numerical factorization is recomputed in place, as long as the sparsity pattern of the system does not change,
+     * e.g., when only channel resistances change between droplet events.
+     * @param[in] reuse Enable or disable the reuse of the symbolic factorization.
+     */
+    void setFactorizationReuse(bool reuse);
+
+    /**
+     * @brief Enables incremental solves, that update the previous solution with Sherman-Morrison-Woodbury rank-k updates when
+     * only k channel conductances changed since the last factorization, instead of refactorizing the system.
+     * The system is refactorized after maxUpdates updates, when more than maxRank channels changed, or when the
+     * componentwise backward error of an updated solution exceeds the tolerance. As the check of the backward error costs
+     * about as much as an update, it is only conducted every checkInterval updates. Only the nodal analyses after changed
+     * channels, i.e., conductNodalAnalysis(changedChannels), are updated, a complete assembly is always factorized.
+     * @param[in] maxUpdates Maximal number of updates between two factorizations (0 disables incremental solves).
+     * @param[in] maxRank Maximal number of changed channels for an update.
+     * @param[in] tolerance Maximal componentwise backward error of an updated solution.
+     * @param[in] checkInterval Number of updates between two checks of the backward error. Must be positive.
+     */
+    void setIncrementalUpdates(int maxUpdates, int maxRank=16, double tolerance=1e-9, int checkInterval=4);
+
     /**
      * @brief Conducts the Modifed Nodal Analysis (e.g., http://qucs.sourceforge.net/tech/node14.html) and computes the pressure levels for each node.
      * Hence, the passed nodes contain the final pressure levels when the function is finished.
@@ -90,6 +184,29 @@ public:
      */
     bool conductNodalAnalysis(std::unordered_map<int, std::unique_ptr<sim::CFDSimulator<T>>>& cfdSimulators);
 
+    /**
+     * @brief Conducts the Modifed Nodal Analysis after the resistances of some channels changed, e.g., by droplets between two events.
+     * The system of equations of the previous call is kept and only the entries of the changed channels are reassembled.
+     * Requires that the topology and the pumps of the network did not change since the previous nodal analysis. Without a
+     * previous nodal analysis, or when the ground nodes of the groups changed, the system is assembled completely.
+     * 
+     * @param[in] changedChannels Ids of the channels whose resistance changed since the previous nodal analysis.
+     */
+    void conductNodalAnalysis(const std::vector<int>& changedChannels);
+
+    /**
+     * @brief Get the accumulated wall-clock time of all nodal analyses that were conducted by this object.
+     * @returns Elapsed time in s.
+     */
+    double getElapsedTime() const;
+
+    /**
+     * @brief Get the accumulated wall-clock time of the assembly of the system of equations of all nodal analyses that were
+     * conducted by this object, i.e., the elapsed time without the factorization, the solve and the storage of the results.
+     * @returns Assembly time in s.
+     */
+    double getAssemblyTime() const;
+
 };
 
 
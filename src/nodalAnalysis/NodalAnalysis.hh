@@ -18,112 +18,290 @@ NodalAnalysis<T>::NodalAnalysis(const arch::Network<T>* network_) {
     }
 
     // Sort nodes into conducting nodes and ground nodes.
-    // First loop, all nodes with id > 0 are conducting nodes.
-    int iPump = nNodes;
-    for (const auto& [key, group] : network->getGroups()) {
-        for (const auto& nodeId : group->nodeIds) {
-            // The node is a conducting node
-            if(!network->getNodes().at(nodeId)->getGround() && nodeId != group->groundNodeId) {
-                conductingNodeIds.emplace(nodeId);
-            } 
-            // The node is an overall ground node, or counts as ground to a group
-            else if (!network->getNodes().at(nodeId)->getGround() && nodeId == group->groundNodeId) {
-                groundNodeIds.emplace(nodeId, iPump);
-                iPump++;
-            }
-        }
-    }
+    updateNodeRoles();
     
-    nPressurePumps = network->getPressurePumps().size() + groundNodeIds.size();
+    nPressurePumps = network->getPressurePumps().size() + nGroupGroundNodes;
     int nNodesAndPressurePumps = nNodes + nPressurePumps + network->getModules().size();
 
-    A = Eigen::MatrixXd::Zero(nNodesAndPressurePumps, nNodesAndPressurePumps);
-    z = Eigen::VectorXd::Zero(nNodesAndPressurePumps);
-    x = Eigen::VectorXd::Zero(nNodesAndPressurePumps);
+    resize(nNodesAndPressurePumps);
+}
 
+template<typename T>
+void NodalAnalysis<T>::setSparseThreshold(int threshold) {
+    sparseThreshold = threshold;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::isSparse() const {
+    return sparse;
+}
+
+template<typename T>
+void NodalAnalysis<T>::setFactorizationReuse(bool reuse) {
+    reuseFactorization = reuse;
+}
+
+template<typename T>
+void NodalAnalysis<T>::setIncrementalUpdates(int maxUpdates, int maxRank, double tolerance, int checkInterval) {
+    if (checkInterval < 1) {
+        throw std::invalid_argument("The interval of the drift checks of incremental solves must be positive.");
+    }
+    maxIncrementalUpdates = maxUpdates;
+    maxUpdateRank = maxRank;
+    driftTolerance = tolerance;
+    driftCheckInterval = checkInterval;
+}
+
+template<typename T>
+void NodalAnalysis<T>::resize(int size) {
+    // Small systems are solved densely, larger systems use the sparse backend
+    bool useSparse = (size >= sparseThreshold);
+
+    // Only reallocate when the dimension or the backend changes, otherwise the system is zeroed in place
+    // and the pattern of the sparse matrix is kept for the next solve
+    if (useSparse != sparse || size != z.size()) {
+        sparse = useSparse;
+        patternAnalyzed = false;
+        factorizationValid = false;
+        if (sparse) {
+            A.resize(0, 0);
+            sparseA.resize(size, size);
+        } else {
+            A = Eigen::MatrixXd::Zero(size, size);
+        }
+        z = Eigen::VectorXd::Zero(size);
+        x = Eigen::VectorXd::Zero(size);
+    } else {
+        if (!sparse) {
+            A.setZero();
+        }
+        z.setZero();
+        x.setZero();
+    }
+    triplets.clear();
 }
 
 template<typename T>
 void NodalAnalysis<T>::clear() {
 
     pressureConvergence = true;
+    systemAssembled = false;
+
+    // The node roles only change when the ground nodes of the groups change
+    if (!nodeRolesValid) {
+        updateNodeRoles();
+    }
+
+    int nNodesAndPressurePumps = nNodes + nPressurePumps + nGroupGroundNodes;
 
-    conductingNodeIds.clear();
-    groundNodeIds.clear();
+    resize(nNodesAndPressurePumps);
+}
+
+template<typename T>
+void NodalAnalysis<T>::updateNodeRoles() {
+    int maxNodeId = -1;
+    for (const auto& [key, node] : network->getNodes()) {
+        maxNodeId = std::max(maxNodeId, key);
+    }
+
+    nodeRoles.assign(maxNodeId + 1, NodeRole::None);
+    groundPumpIds.assign(maxNodeId + 1, -1);
+    nGroupGroundNodes = 0;
+
+    for (const auto& [key, node] : network->getNodes()) {
+        if (node->getGround()) {
+            nodeRoles[key] = NodeRole::Ground;
+        }
+    }
 
     int iPump = network->getNodes().size() + network->getVirtualNodes() + network->getPressurePumps().size();
 
     for (const auto& [key, group] : network->getGroups()) {
         for (const auto& nodeId : group->nodeIds) {
             // The node is a conducting node
-            if(!network->getNodes().at(nodeId)->getGround() && nodeId != group->groundNodeId) {
-                conductingNodeIds.emplace(nodeId);
+            if(nodeRoles[nodeId] != NodeRole::Ground && nodeId != group->groundNodeId) {
+                nodeRoles[nodeId] = NodeRole::Conducting;
             } 
             // The node is an overall ground node, or counts as ground to a group
-            else if (!network->getNodes().at(nodeId)->getGround() && nodeId == group->groundNodeId) {
-                groundNodeIds.emplace(nodeId, iPump);
+            else if (nodeRoles[nodeId] != NodeRole::Ground && nodeId == group->groundNodeId) {
+                nodeRoles[nodeId] = NodeRole::GroupGround;
+                groundPumpIds[nodeId] = iPump;
                 iPump++;
+                nGroupGroundNodes++;
             }
         }
     }
 
-    int nNodesAndPressurePumps = nNodes + nPressurePumps + groundNodeIds.size();
-
-    A = Eigen::MatrixXd::Zero(nNodesAndPressurePumps, nNodesAndPressurePumps);
-    z = Eigen::VectorXd::Zero(nNodesAndPressurePumps);
-    x = Eigen::VectorXd::Zero(nNodesAndPressurePumps);
-
-    A.setZero();
-    z.setZero();
+    nodeRolesValid = true;
 }
 
 template<typename T>
 void NodalAnalysis<T>::conductNodalAnalysis() {
+    auto start = std::chrono::steady_clock::now();
     clear();
     readConductance();
     readPressurePumps();
     readFlowRatePumps();
+    auto assembled = std::chrono::steady_clock::now();
     solve();
+    systemAssembled = true;
     setResults();
     initGroundNodes();
+    elapsedTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assemblyTime += std::chrono::duration<double>(assembled - start).count();
+}
+
+template<typename T>
+void NodalAnalysis<T>::conductNodalAnalysis(const std::vector<int>& changedChannels) {
+    // The roles of the nodes determine the rows of the system, hence it is assembled completely when they changed
+    if (!systemAssembled || !nodeRolesValid) {
+        conductNodalAnalysis();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    pressureConvergence = true;
+    updateConductance(changedChannels);
+    auto assembled = std::chrono::steady_clock::now();
+    solve(true);
+    setResults();
+    initGroundNodes();
+    elapsedTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assemblyTime += std::chrono::duration<double>(assembled - start).count();
 }
 
 template<typename T>
 bool NodalAnalysis<T>::conductNodalAnalysis(std::unordered_map<int, std::unique_ptr<sim::CFDSimulator<T>>>& cfdSimulators) {
+    auto start = std::chrono::steady_clock::now();
     clear();
     readConductance();
     readCfdSimulators(cfdSimulators);
     updateReferenceP();
     readPressurePumps();
     readFlowRatePumps();
+    auto assembled = std::chrono::steady_clock::now();
     solve();
     setResults();
     writeCfdSimulators(cfdSimulators);
     initGroundNodes(cfdSimulators);
+    elapsedTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assemblyTime += std::chrono::duration<double>(assembled - start).count();
     return pressureConvergence;
 }
 
+template<typename T>
+double NodalAnalysis<T>::getElapsedTime() const {
+    return elapsedTime;
+}
+
+template<typename T>
+double NodalAnalysis<T>::getAssemblyTime() const {
+    return assemblyTime;
+}
+
 template<typename T>
 void NodalAnalysis<T>::readConductance() {
-    // loop through channels and build matrix G
-    for (const auto& channel : network->getChannels()) {
-        auto nodeAMatrixId = channel.second->getNodeA();
-        auto nodeBMatrixId = channel.second->getNodeB();
-        const T conductance = 1. / channel.second->getResistance();
+    // loop through the edges of the CSR view and build matrix G
+    const auto& csr = network->getCSR();
+    edgeResistances.resize(csr.nEdges());
+    if (sparse) {
+        edgeTriplets.resize(csr.nEdges());
+    }
+    for (int e = 0; e < csr.nEdges(); ++e) {
+        if (sparse) {
+            edgeTriplets[e] = triplets.size();
+        }
+        edgeResistances[e] = csr.channels[e]->getResistance();
+        auto nodeAMatrixId = csr.nodeIds[csr.nodeA[e]];
+        auto nodeBMatrixId = csr.nodeIds[csr.nodeB[e]];
+        const T conductance = 1. / edgeResistances[e];
 
         // main diagonal elements of G
-        if (!network->getNodes().at(nodeAMatrixId)->getGround()) {
-            A(nodeAMatrixId, nodeAMatrixId) += conductance;
+        if (!isGround(nodeAMatrixId)) {
+            addToMatrix(nodeAMatrixId, nodeAMatrixId, conductance);
         }
 
-        if (!network->getNodes().at(nodeBMatrixId)->getGround()) {
-            A(nodeBMatrixId, nodeBMatrixId) += conductance;
+        if (!isGround(nodeBMatrixId)) {
+            addToMatrix(nodeBMatrixId, nodeBMatrixId, conductance);
         }
 
         // minor diagonal elements of G (if no ground node was present)
-        if (!network->getNodes().at(nodeAMatrixId)->getGround() && !network->getNodes().at(nodeBMatrixId)->getGround()) {
-            A(nodeAMatrixId, nodeBMatrixId) -= conductance;
-            A(nodeBMatrixId, nodeAMatrixId) -= conductance;
+        if (!isGround(nodeAMatrixId) && !isGround(nodeBMatrixId)) {
+            addToMatrix(nodeAMatrixId, nodeBMatrixId, -conductance);
+            addToMatrix(nodeBMatrixId, nodeAMatrixId, -conductance);
+        }
+    }
+}
+
+template<typename T>
+void NodalAnalysis<T>::updateConductance(const std::vector<int>& channelIds) {
+    const auto& csr = network->getCSR();
+    changedRows.clear();
+    for (int channelId : channelIds) {
+        const int e = (channelId >= 0 && channelId < static_cast<int>(csr.edgeIndex.size())) ? csr.edgeIndex[channelId] : -1;
+        if (e < 0) {
+            throw std::invalid_argument("Channel with ID " + std::to_string(channelId) + " does not exist.");
+        }
+        edgeResistances[e] = csr.channels[e]->getResistance();
+        auto nodeAMatrixId = csr.nodeIds[csr.nodeA[e]];
+        auto nodeBMatrixId = csr.nodeIds[csr.nodeB[e]];
+        const T conductance = 1. / edgeResistances[e];
+
+        if (sparse) {
+            // overwrite the triplets of the edge in the order in which readConductance added them
+            int triplet = edgeTriplets[e];
+            if (!isGround(nodeAMatrixId)) {
+                triplets[triplet++] = Eigen::Triplet<double>(nodeAMatrixId, nodeAMatrixId, conductance);
+            }
+            if (!isGround(nodeBMatrixId)) {
+                triplets[triplet++] = Eigen::Triplet<double>(nodeBMatrixId, nodeBMatrixId, conductance);
+            }
+            if (!isGround(nodeAMatrixId) && !isGround(nodeBMatrixId)) {
+                triplets[triplet++] = Eigen::Triplet<double>(nodeAMatrixId, nodeBMatrixId, -conductance);
+                triplets[triplet++] = Eigen::Triplet<double>(nodeBMatrixId, nodeAMatrixId, -conductance);
+            }
+        } else {
+            changedRows.push_back(csr.nodeA[e]);
+            changedRows.push_back(csr.nodeB[e]);
+        }
+    }
+    if (sparse) {
+        return;
+    }
+
+    // The rows of G that contain a changed channel are summed up again over all adjacent channels in the order of
+    // readConductance, such that the system is identical to a complete assembly
+    std::sort(changedRows.begin(), changedRows.end());
+    changedRows.erase(std::unique(changedRows.begin(), changedRows.end()), changedRows.end());
+    for (int node : changedRows) {
+        const int row = csr.nodeIds[node];
+        if (isGround(row)) {
+            continue;
+        }
+        for (int i = csr.offsets[node]; i < csr.offsets[node + 1]; ++i) {
+            const int e = csr.adjacentEdges[i];
+            A(row, csr.nodeIds[csr.nodeA[e]]) = 0.0;
+            A(row, csr.nodeIds[csr.nodeB[e]]) = 0.0;
+        }
+        for (int i = csr.offsets[node]; i < csr.offsets[node + 1]; ++i) {
+            const int e = csr.adjacentEdges[i];
+            auto nodeAMatrixId = csr.nodeIds[csr.nodeA[e]];
+            auto nodeBMatrixId = csr.nodeIds[csr.nodeB[e]];
+            const T conductance = 1. / edgeResistances[e];
+            if (nodeAMatrixId == row) {
+                A(row, row) += conductance;
+            }
+            if (nodeBMatrixId == row) {
+                A(row, row) += conductance;
+            }
+            if (!isGround(nodeAMatrixId) && !isGround(nodeBMatrixId)) {
+                if (nodeAMatrixId == row) {
+                    A(row, nodeBMatrixId) -= conductance;
+                }
+                if (nodeBMatrixId == row) {
+                    A(row, nodeAMatrixId) -= conductance;
+                }
+            }
         }
     }
 }
@@ -135,10 +313,10 @@ void NodalAnalysis<T>::updateReferenceP() {
         if (group->initialized) {
             auto& node = network->getNodes().at(group->groundNodeId);
             group->pRef = node->getPressure();
-            int pumpId = groundNodeIds.at(group->groundNodeId);
+            int pumpId = groundPumpIds[group->groundNodeId];
 
-            A(group->groundNodeId, pumpId) = 1;   // matrix B
-            A(pumpId, group->groundNodeId) = 1;   // matrix C
+            setMatrix(group->groundNodeId, pumpId, 1);   // matrix B
+            setMatrix(pumpId, group->groundNodeId, 1);   // matrix C
 
             z(pumpId) = node->getPressure();
         }
@@ -153,14 +331,14 @@ void NodalAnalysis<T>::readPressurePumps() {
         auto nodeAMatrixId = pressurePump.second->getNodeA();
         auto nodeBMatrixId = pressurePump.second->getNodeB();
 
-        if (contains(conductingNodeIds, nodeAMatrixId)) {
-            A(nodeAMatrixId, iPump) = -1;   // matrix B
-            A(iPump, nodeAMatrixId) = -1;   // matrix C
+        if (isConducting(nodeAMatrixId)) {
+            setMatrix(nodeAMatrixId, iPump, -1);   // matrix B
+            setMatrix(iPump, nodeAMatrixId, -1);   // matrix C
         }
 
-        if (contains(conductingNodeIds, nodeBMatrixId)) {
-            A(nodeBMatrixId, iPump) = 1;   // matrix B
-            A(iPump, nodeBMatrixId) = 1;   // matrix C
+        if (isConducting(nodeBMatrixId)) {
+            setMatrix(nodeBMatrixId, iPump, 1);   // matrix B
+            setMatrix(iPump, nodeBMatrixId, 1);   // matrix C
         }
 
         z(iPump) = pressurePump.second->getPressure();
@@ -177,19 +355,213 @@ void NodalAnalysis<T>::readFlowRatePumps() {
         auto nodeBMatrixId = flowRatePump.second->getNodeB();
         const T flowRate = flowRatePump.second->getFlowRate();
 
-        if (contains(conductingNodeIds, nodeAMatrixId)){
+        if (isConducting(nodeAMatrixId)){
             z(nodeAMatrixId) = -flowRate;
         }
-        if (contains(conductingNodeIds, nodeBMatrixId)){
+        if (isConducting(nodeBMatrixId)){
             z(nodeBMatrixId) = flowRate;
         }
     }
 }
 
 template<typename T>
-void NodalAnalysis<T>::solve() {
+void NodalAnalysis<T>::solve(bool incremental) {
     // solve equation x = A^(-1) * z
-    x = A.colPivHouseholderQr().solve(z);
+    // the empty rows of a reassembled system are already pinned
+    if (sparse && !systemAssembled) {
+        pinEmptyRows();
+    }
+
+    // Update the previous solution if only few channel conductances changed. A complete assembly may have changed other
+    // entries of the system, e.g., of modules or reference pressures, which the update does not account for
+    if (incremental && maxIncrementalUpdates > 0 && factorizationValid && updatesSinceFactorization < maxIncrementalUpdates) {
+        if (solveIncremental()) {
+            updatesSinceFactorization++;
+            return;
+        }
+    }
+
+    if (sparse) {
+        factorizationValid = solveSparse();
+    } else {
+        x = denseSolver.compute(A).solve(z);
+        factorizationValid = true;
+    }
+
+    if (maxIncrementalUpdates > 0) {
+        storeFactorizedConductances();
+    }
+}
+
+template<typename T>
+void NodalAnalysis<T>::pinEmptyRows() {
+    // Rows without any entry (ground nodes, unused pump rows) would make the sparse LU decomposition
+    // fail, hence they are pinned to x = 0, which is the value the dense solver yields for them
+    occupiedRows.assign(z.size(), false);
+    for (const auto& triplet : triplets) {
+        occupiedRows[triplet.row()] = true;
+    }
+    for (int i = 0; i < z.size(); ++i) {
+        if (!occupiedRows[i]) {
+            triplets.emplace_back(i, i, 1.0);
+            z(i) = 0.0;
+        }
+    }
+}
+
+template<typename T>
+bool NodalAnalysis<T>::solveSparse() {
+    // The symbolic factorization only has to be recomputed when the sparsity pattern changed
+    if (!(reuseFactorization && patternAnalyzed && updateSparseValues())) {
+        sparseA.setFromTriplets(triplets.begin(), triplets.end());
+        sparseSolver.analyzePattern(sparseA);
+        patternAnalyzed = true;
+    }
+    sparseSolver.factorize(sparseA);
+    if (sparseSolver.info() == Eigen::Success) {
+        x = sparseSolver.solve(z);
+        return true;
+    }
+
+    // Singular systems (e.g., floating groups) fall back to the rank-revealing dense solver
+    if (sparseSolver.info() != Eigen::Success) {
+        patternAnalyzed = false;
+        #ifdef VERBOSE
+            std::cout << "[NodalAnalysis] Sparse LU decomposition failed, falling back to dense solver." << std::endl;
+        #endif
+        x = Eigen::MatrixXd(sparseA).colPivHouseholderQr().solve(z);
+    }
+    return false;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::solveIncremental() {
+    // Collect the edges whose conductance changed since the last factorization
+    const auto& csr = network->getCSR();
+    if (static_cast<int>(factorizedConductances.size()) != csr.nEdges()) {
+        return false;
+    }
+    std::vector<int> changedEdges;
+    std::vector<double> changes;
+    for (int e = 0; e < csr.nEdges(); ++e) {
+        const double change = 1. / edgeResistances[e] - factorizedConductances[e];
+        if (change != 0.0) {
+            if (static_cast<int>(changedEdges.size()) == maxUpdateRank) {
+                return false;
+            }
+            changedEdges.push_back(e);
+            changes.push_back(change);
+        }
+    }
+
+    // Sherman-Morrison-Woodbury update of the factorized system A with A' = A + U * D * U^T:
+    // x = y - W * D * (I + U^T * W * D)^(-1) * U^T * y, with y = A^(-1) * z and W = A^(-1) * U
+    const int rank = changedEdges.size();
+    Eigen::VectorXd y = solveFactorized(z);
+    Eigen::MatrixXd W(z.size(), rank);
+    for (int j = 0; j < rank; ++j) {
+        // A^(-1) * u only depends on the nodes of the edge, hence it is kept until the next factorization
+        auto [solution, inserted] = updateSolutions.try_emplace(changedEdges[j]);
+        if (inserted) {
+            solution->second = solveFactorized(updateVector(changedEdges[j]));
+        }
+        W.col(j) = solution->second;
+    }
+
+    Eigen::MatrixXd capacitance = Eigen::MatrixXd::Identity(rank, rank);
+    Eigen::VectorXd projection(rank);
+    for (int i = 0; i < rank; ++i) {
+        projection(i) = projectUpdate(changedEdges[i], y);
+        for (int j = 0; j < rank; ++j) {
+            capacitance(i, j) += projectUpdate(changedEdges[i], W.col(j)) * changes[j];
+        }
+    }
+    Eigen::VectorXd correction = capacitance.partialPivLu().solve(projection);
+    for (int j = 0; j < rank; ++j) {
+        correction(j) *= changes[j];
+    }
+    x = y - W * correction;
+
+    // Refactorize if the updated solution drifted away from the solution of the assembled system, which is checked
+    // every driftCheckInterval updates
+    if ((updatesSinceFactorization + 1) % driftCheckInterval != 0) {
+        return true;
+    }
+    return !hasDrifted();
+}
+
+template<typename T>
+Eigen::VectorXd NodalAnalysis<T>::solveFactorized(const Eigen::VectorXd& rhs) {
+    if (sparse) {
+        return sparseSolver.solve(rhs);
+    }
+    return denseSolver.solve(rhs);
+}
+
+template<typename T>
+Eigen::VectorXd NodalAnalysis<T>::updateVector(int edge) {
+    // Mirrors readConductance, i.e., ground nodes have no row in matrix G
+    const auto& csr = network->getCSR();
+    const int nodeAId = csr.nodeIds[csr.nodeA[edge]];
+    const int nodeBId = csr.nodeIds[csr.nodeB[edge]];
+    Eigen::VectorXd u = Eigen::VectorXd::Zero(z.size());
+    if (!isGround(nodeAId)) {
+        u(nodeAId) = 1.0;
+    }
+    if (!isGround(nodeBId)) {
+        u(nodeBId) = -1.0;
+    }
+    return u;
+}
+
+template<typename T>
+double NodalAnalysis<T>::projectUpdate(int edge, const Eigen::VectorXd& vector) {
+    const auto& csr = network->getCSR();
+    const int nodeAId = csr.nodeIds[csr.nodeA[edge]];
+    const int nodeBId = csr.nodeIds[csr.nodeB[edge]];
+    double projection = 0.0;
+    if (!isGround(nodeAId)) {
+        projection += vector(nodeAId);
+    }
+    if (!isGround(nodeBId)) {
+        projection -= vector(nodeBId);
+    }
+    return projection;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::hasDrifted() {
+    // componentwise backward error |z - A * x|_i / (|A| * |x| + |z|)_i of the assembled system
+    Eigen::VectorXd residual = z;
+    Eigen::VectorXd scale = z.cwiseAbs();
+    if (sparse) {
+        for (const auto& triplet : triplets) {
+            const double product = triplet.value() * x(triplet.col());
+            residual(triplet.row()) -= product;
+            scale(triplet.row()) += std::abs(product);
+        }
+    } else {
+        residual -= A * x;
+        scale += A.cwiseAbs() * x.cwiseAbs();
+    }
+
+    for (int i = 0; i < residual.size(); ++i) {
+        if (std::abs(residual(i)) > driftTolerance * scale(i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void NodalAnalysis<T>::storeFactorizedConductances() {
+    updatesSinceFactorization = 0;
+    updateSolutions.clear();
+    const auto& csr = network->getCSR();
+    factorizedConductances.resize(csr.nEdges());
+    for (int e = 0; e < csr.nEdges(); ++e) {
+        factorizedConductances[e] = 1. / edgeResistances[e];
+    }
 }
 
 template<typename T>
@@ -198,18 +570,22 @@ void NodalAnalysis<T>::setResults() {
     for (const auto& [key, group] : network->getGroups()) {
         for (auto nodeMatrixId : group->nodeIds) {
             auto& node = network->getNodes().at(nodeMatrixId);
-            if (contains(conductingNodeIds, nodeMatrixId)) {
+            if (isConducting(nodeMatrixId)) {
                 node->setPressure(x(nodeMatrixId));
-            } else if (node->getGround()) {
+            } else if (isGround(nodeMatrixId)) {
                 node->setPressure(0.0);
             }
         }
     }
 
-    for (auto& channel : network->getChannels()) {
-        auto& nodeA = network->getNodes().at(channel.second->getNodeA());
-        auto& nodeB = network->getNodes().at(channel.second->getNodeB());
-        channel.second->setPressure(nodeA->getPressure() - nodeB->getPressure());
+    const auto& csr = network->getCSR();
+    edgeFlowRates.resize(csr.nEdges());
+    for (int e = 0; e < csr.nEdges(); ++e) {
+        auto& nodeA = network->getNodes().at(csr.nodeIds[csr.nodeA[e]]);
+        auto& nodeB = network->getNodes().at(csr.nodeIds[csr.nodeB[e]]);
+        const T pressure = nodeA->getPressure() - nodeB->getPressure();
+        csr.channels[e]->setPressure(pressure);
+        edgeFlowRates[e] = pressure / edgeResistances[e];
     }
 
     // set flow rate at pressure pumps
@@ -244,8 +620,9 @@ void NodalAnalysis<T>::initGroundNodes() {
                     group->groundChannelId = channelId;
                 }
             }
-            groundNodeIds.emplace(group->groundNodeId, 0);
-            conductingNodeIds.erase(group->groundNodeId);
+            // The reference pressure row of the new group ground node is assigned in the next clear()
+            nodeRoles[group->groundNodeId] = NodeRole::GroupGround;
+            nodeRolesValid = false;
             group->initialized = true;
         }
     }
@@ -275,8 +652,9 @@ void NodalAnalysis<T>::initGroundNodes(std::unordered_map<int, std::unique_ptr<s
                     group->groundChannelId = channelId;
                 }
             }
-            groundNodeIds.emplace(group->groundNodeId, 0);
-            conductingNodeIds.erase(group->groundNodeId);
+            // The reference pressure row of the new group ground node is assigned in the next clear()
+            nodeRoles[group->groundNodeId] = NodeRole::GroupGround;
+            nodeRolesValid = false;
             group->initialized = true;
         }
     }
@@ -288,7 +666,7 @@ void NodalAnalysis<T>::initGroundNodes(std::unordered_map<int, std::unique_ptr<s
             std::unordered_map<int, bool> groundNodes;
             for (const auto& [nodeId, node] : cfdSimulator->getModule()->getNodes()) {
                 T flowRate = 0.0;
-                if (contains(groundNodeIds, nodeId)) {
+                if (isGroupGround(nodeId)) {
                     groundNodes.try_emplace(nodeId, true);
                     for (auto& [key, group] : network->getGroups()) {
                         if (nodeId == group->groundNodeId) {
@@ -319,18 +697,18 @@ void NodalAnalysis<T>::readCfdSimulators(std::unordered_map<int, std::unique_ptr
                 const T conductance = 1. / channel->getResistance();
 
                 // main diagonal elements of G
-                if (contains(conductingNodeIds, nodeAMatrixId)) {
-                    A(nodeAMatrixId, nodeAMatrixId) += conductance;
+                if (isConducting(nodeAMatrixId)) {
+                    addToMatrix(nodeAMatrixId, nodeAMatrixId, conductance);
                 }
 
-                if (contains(conductingNodeIds, nodeBMatrixId)) {
-                    A(nodeBMatrixId, nodeBMatrixId) += conductance;
+                if (isConducting(nodeBMatrixId)) {
+                    addToMatrix(nodeBMatrixId, nodeBMatrixId, conductance);
                 }
 
                 // minor diagonal elements of G (if no ground node was present)
-                if (contains(conductingNodeIds, nodeAMatrixId) && contains(conductingNodeIds, nodeBMatrixId)) {
-                    A(nodeAMatrixId, nodeBMatrixId) -= conductance;
-                    A(nodeBMatrixId, nodeAMatrixId) -= conductance;
+                if (isConducting(nodeAMatrixId) && isConducting(nodeBMatrixId)) {
+                    addToMatrix(nodeAMatrixId, nodeBMatrixId, -conductance);
+                    addToMatrix(nodeBMatrixId, nodeAMatrixId, -conductance);
                 }
             }
         }
@@ -341,12 +719,12 @@ void NodalAnalysis<T>::readCfdSimulators(std::unordered_map<int, std::unique_ptr
         else if ( cfdSimulator->getInitialized() ) {
             for (const auto& [key, node] : cfdSimulator->getModule()->getNodes()) {
                 // Write the module's flowrates into vector i if the node is not a group's ground node
-                if (contains(conductingNodeIds, key)) {
+                if (isConducting(key)) {
                     T flowRate = cfdSimulator->getFlowRates().at(key) * cfdSimulator->getOpenings().at(key).height;
                     z(key) = -flowRate;
                 } 
                 // Write module's pressure into matrix B, C and vector e
-                else if (contains(groundNodeIds, key)) {
+                else if (isGroupGround(key)) {
                     T pressure = cfdSimulator->getPressures().at(key);
                     node->setPressure(pressure);
                 }
@@ -360,74 +738,106 @@ void NodalAnalysis<T>::writeCfdSimulators(std::unordered_map<int, std::unique_pt
 
     // Set the pressures and flow rates on the boundary nodes of the modules
     for (auto& cfdSimulator : cfdSimulators) {
-        std::unordered_map<int, T> old_pressures = cfdSimulator.second->getPressures();
-        std::unordered_map<int, T> old_flowrates = cfdSimulator.second->getFlowRates();
-        std::unordered_map<int, T> pressures_ = cfdSimulator.second->getPressures();
-        std::unordered_map<int, T> flowRates_ = cfdSimulator.second->getFlowRates();
+        const std::unordered_map<int, T>& old_pressures = cfdSimulator.second->getPressures();
+        const std::unordered_map<int, T>& old_flowrates = cfdSimulator.second->getFlowRates();
+        std::unordered_map<int, T> new_pressures;
+        std::unordered_map<int, T> new_flowRates;
         for (auto& [key, node] : cfdSimulator.second->getModule()->getNodes()){
             // Communicate pressure to the module
-            if (contains(conductingNodeIds, key)) {
+            if (isConducting(key)) {
                 T old_pressure = old_pressures.at(key);
                 T new_pressure = node->getPressure();
-                T set_pressure = 0.0;
-                if (old_pressure > 0 ) {
-                    set_pressure = old_pressure + cfdSimulator.second->getAlpha(key) * ( new_pressure - old_pressure );
-                } else {
-                    set_pressure = new_pressure;
-                }
-                pressures_.at(key) = set_pressure;
+                new_pressures.try_emplace(key, new_pressure);
 
                 if (abs(old_pressure - new_pressure) > 1e-2) {
                     pressureConvergence = false;
                 }
             }
             // Communicate the flow rate to the module
-            else if (contains(groundNodeIds, key)) {
+            else if (isGroupGround(key)) {
                 T old_flowRate = old_flowrates.at(key) ;
-                T new_flowRate = x(groundNodeIds.at(key)) / cfdSimulator.second->getOpenings().at(key).width;
-                T set_flowRate = 0.0;
-                if (old_flowRate > 0 ) {
-                    set_flowRate = old_flowRate + 5 * cfdSimulator.second->getAlpha(key) *  ( new_flowRate - old_flowRate );
-                } else {
-                    set_flowRate = new_flowRate;
-                }
-                flowRates_.at(key) = set_flowRate;
+                T new_flowRate = x(groundPumpIds[key]) / cfdSimulator.second->getOpenings().at(key).width;
+                new_flowRates.try_emplace(key, new_flowRate);
 
                 if (abs(old_flowRate - new_flowRate) > 1e-2) {
                     pressureConvergence = false;
                 }
             }
         }
+
+        // The update scheme of the module computes the values that are set from the old and new values
+        cfdSimulator.second->getUpdateScheme()->update(cfdSimulator.second->getModule()->getId(), old_pressures, new_pressures, old_flowrates, new_flowRates);
+
+        std::unordered_map<int, T> pressures_ = old_pressures;
+        std::unordered_map<int, T> flowRates_ = old_flowrates;
+        for (auto& [key, pressure] : new_pressures) {
+            pressures_.at(key) = pressure;
+        }
+        for (auto& [key, flowRate] : new_flowRates) {
+            flowRates_.at(key) = flowRate;
+        }
         cfdSimulator.second->storePressures(pressures_);
         cfdSimulator.second->storeFlowRates(flowRates_);
     }
 }
 
 template<typename T>
-bool NodalAnalysis<T>::contains( const std::unordered_set<int>& set, int key) {
-    bool contain = false;
-    for (auto& nodeId : set) {
-        if (key == nodeId) {
-            contain = true;
+bool NodalAnalysis<T>::isConducting(int nodeId) const {
+    return nodeRoles[nodeId] == NodeRole::Conducting;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::isGroupGround(int nodeId) const {
+    return nodeRoles[nodeId] == NodeRole::GroupGround;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::isGround(int nodeId) const {
+    return nodeRoles[nodeId] == NodeRole::Ground;
+}
+
+template<typename T>
+bool NodalAnalysis<T>::updateSparseValues() {
+    // Overwrite the values of the previous system in place, fails if an entry is not part of the pattern
+    sparseA.coeffs().setZero();
+    for (const auto& triplet : triplets) {
+        const int* begin = sparseA.innerIndexPtr() + sparseA.outerIndexPtr()[triplet.col()];
+        const int* end = sparseA.innerIndexPtr() + sparseA.outerIndexPtr()[triplet.col() + 1];
+        const int* entry = std::lower_bound(begin, end, triplet.row());
+        if (entry == end || *entry != triplet.row()) {
+            return false;
         }
+        sparseA.valuePtr()[entry - sparseA.innerIndexPtr()] += triplet.value();
     }
-    return contain;
+    return true;
 }
 
 template<typename T>
-bool NodalAnalysis<T>::contains( const std::unordered_map<int, int>& map, int key) {
-    bool contain = false;
-    for (auto& [nodeId, pumpId] : map) {
-        if (key == nodeId) {
-            contain = true;
-        }
+void NodalAnalysis<T>::addToMatrix(int row, int col, double value) {
+    if (sparse) {
+        triplets.emplace_back(row, col, value);
+    } else {
+        A(row, col) += value;
+    }
+}
+
+template<typename T>
+void NodalAnalysis<T>::setMatrix(int row, int col, double value) {
+    // The entries of B and C are unique, hence a triplet is equivalent to an assignment
+    if (sparse) {
+        triplets.emplace_back(row, col, value);
+    } else {
+        A(row, col) = value;
     }
-    return contain;
 }
 
 template<typename T>
 void NodalAnalysis<T>::printSystem() {
-    std::cout << "Matrix A:\n" << A  << "\n\n" << std::endl;
+    if (sparse) {
+        std::cout << "Matrix A:\n" << Eigen::MatrixXd(sparseA)  << "\n\n" << std::endl;
+    } else {
+        std::cout << "Matrix A:\n" << A  << "\n\n" << std::endl;
+    }
     std::cout << "Vector z:\n" << z  << "\n\n" << std::endl;
     std::cout << "Vector x:\n" << x  << "\n\n" << std::endl;
 }
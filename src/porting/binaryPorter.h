@@ -0,0 +1,244 @@
+/**
+ * @file binaryPorter.h
+ *
+ * Binary result format. All values are written in the native byte order and are 8 bytes wide, such that every array of
+ * the file is aligned and can be used in place, e.g., after memory-mapping the file:
+ * - Header: the magic "MMFTRES1", the number of states, nodes and edges (int64), and the node and edge ids in ascending order (int64).
+ * - States: one row per state, with the time, the pressure of each node and the flow rate of each edge (float64).
+ * - Optional sections, each starting with an 8 character tag:
+ *   - "DROPLETS": the number of droplet positions, boundaries and occupied channels (int64), the state, droplet id, first
+ *     boundary and first occupied channel of each position (int64, the offsets with a trailing end offset), the channel
+ *     and the direction of each boundary (int64), the relative position of each boundary (float64), and the ids of the
+ *     occupied channels (int64).
+ *   - "MIXTURES": the number of mixture positions (int64), the state, channel and mixture id of each position (int64),
+ *     and the relative start and end of each position (float64).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Simulation;
+
+}   // namespace sim
+
+namespace result {
+
+// Forward declared dependencies
+template<typename T>
+struct State;
+
+struct ColumnIndex;
+
+}   // namespace result
+
+namespace porting {
+
+/**
+ * @brief Write the header of the binary result format.
+ * @param[in] file Stream to which the header is written.
+ * @param[in] nStates Number of states.
+ * @param[in] nodeColumns Columns of the nodes.
+ * @param[in] edgeColumns Columns of the edges.
+*/
+inline void writeBinaryHeader (std::ostream& file, std::int64_t nStates, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns);
+
+/**
+ * @brief Write the time, pressures and flow rates of a state as a row of the binary result format.
+ * @param[in] file Stream to which the row is written.
+ * @param[in] state The state that should be written, which must not contain nodes or edges without a column.
+ * @param[in] nodeColumns Columns of the nodes.
+ * @param[in] edgeColumns Columns of the edges.
+ * @param[in, out] row Buffer of the row.
+*/
+template<typename T>
+void writeBinaryRow (std::ostream& file, result::State<T>* state, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns, std::vector<double>& row);
+
+/**
+ * @brief Write an array of values to the binary result format.
+ * @param[in] file Stream to which the values are written.
+ * @param[in] values The values.
+*/
+template<typename V>
+void writeBinaryArray (std::ostream& file, const std::vector<V>& values);
+
+/**
+ * @brief Write the result of a simulation to a file in the binary result format.
+ * @param[in] file Location of the file, which is overwritten.
+ * @param[in] simulation Pointer to the simulation of which the results are written.
+*/
+template<typename T>
+void resultToBinary (std::string file, sim::Simulation<T>* simulation);
+
+/**
+ * @brief Struct that contains the droplet positions of a binary result. All pointers point into the file.
+*/
+struct BinaryDropletPositions {
+    std::int64_t size = 0;                          ///< Number of droplet positions.
+    std::int64_t nBoundaries = 0;                   ///< Number of boundaries of all positions.
+    std::int64_t nChannels = 0;                     ///< Number of occupied channels of all positions.
+    const std::int64_t* states = nullptr;           ///< Index of the state of each position.
+    const std::int64_t* dropletIds = nullptr;       ///< Id of the droplet of each position.
+    const std::int64_t* boundaryOffsets = nullptr;  ///< First boundary of each position, followed by the number of boundaries.
+    const std::int64_t* channelOffsets = nullptr;   ///< First occupied channel of each position, followed by the number of occupied channels.
+    const std::int64_t* boundaryChannels = nullptr; ///< Channel id of each boundary.
+    const std::int64_t* volumeTowardsNodeA = nullptr;  ///< Whether the volume of the droplet lies towards node A of the channel of each boundary.
+    const double* boundaryPositions = nullptr;      ///< Relative position of each boundary in its channel.
+    const std::int64_t* channelIds = nullptr;       ///< Ids of the channels that are fully occupied by the droplets.
+};
+
+/**
+ * @brief Struct that contains the mixture positions of a binary result. All pointers point into the file.
+*/
+struct BinaryMixturePositions {
+    std::int64_t size = 0;                          ///< Number of mixture positions.
+    const std::int64_t* states = nullptr;           ///< Index of the state of each position.
+    const std::int64_t* channelIds = nullptr;       ///< Id of the channel of each position.
+    const std::int64_t* mixtureIds = nullptr;       ///< Id of the mixture of each position.
+    const double* starts = nullptr;                 ///< Relative start of each position in its channel.
+    const double* ends = nullptr;                   ///< Relative end of each position in its channel.
+};
+
+/**
+ * @brief Class to read a result in the binary result format. The file is memory-mapped, such that the values are read in
+ * place without parsing or copying. On Windows, the file is read into memory instead. The file of a BinarySink that was
+ * not flushed at the end of its simulation can be read as well, its complete rows are the states.
+*/
+class BinaryResult {
+private:
+    const std::byte* data = nullptr;                ///< Content of the file.
+    std::size_t size = 0;                           ///< Size of the file in bytes.
+    #ifdef _WIN32
+    std::vector<std::byte> buffer;                  ///< Content of the file.
+    #endif
+    std::int64_t nStates = 0;                       ///< Number of states.
+    std::int64_t nNodes = 0;                        ///< Number of nodes.
+    std::int64_t nEdges = 0;                        ///< Number of edges.
+    const std::int64_t* nodeIds = nullptr;          ///< Node id of each pressure column.
+    const std::int64_t* edgeIds = nullptr;          ///< Edge id of each flow rate column.
+    const double* rows = nullptr;                   ///< Rows of the states.
+    BinaryDropletPositions dropletPositions;        ///< Droplet positions of all states.
+    BinaryMixturePositions mixturePositions;        ///< Mixture positions of all states.
+
+    /**
+     * @brief Get an array of the file and move the offset behind it.
+     */
+    template<typename V>
+    const V* take(std::size_t& offset, std::int64_t count) const;
+
+    /**
+     * @brief Find the arrays of the header, the states and the sections.
+     */
+    void parse();
+
+public:
+    /**
+     * @brief Constructor of a binary result, which maps the file into memory.
+     * @param[in] file Location of the file.
+     */
+    explicit BinaryResult(std::string file);
+
+    BinaryResult(const BinaryResult&) = delete;
+    BinaryResult& operator=(const BinaryResult&) = delete;
+
+    /**
+     * @brief Destructor of a binary result, which unmaps the file.
+     */
+    ~BinaryResult();
+
+    /**
+     * @brief Get the number of states.
+     * @returns Number of states.
+     */
+    std::int64_t getNumberOfStates() const;
+
+    /**
+     * @brief Get the number of nodes, i.e., pressure columns.
+     * @returns Number of nodes.
+     */
+    std::int64_t getNumberOfNodes() const;
+
+    /**
+     * @brief Get the number of edges, i.e., flow rate columns.
+     * @returns Number of edges.
+     */
+    std::int64_t getNumberOfEdges() const;
+
+    /**
+     * @brief Get the ids of the nodes in the order of the pressure columns.
+     * @returns Pointer to the first of getNumberOfNodes() ids.
+     */
+    const std::int64_t* getNodeIds() const;
+
+    /**
+     * @brief Get the ids of the edges in the order of the flow rate columns.
+     * @returns Pointer to the first of getNumberOfEdges() ids.
+     */
+    const std::int64_t* getEdgeIds() const;
+
+    /**
+     * @brief Get the number of values of a row, i.e., the time, the pressures and the flow rates of a state.
+     * @returns Number of values per row.
+     */
+    std::size_t getRowSize() const;
+
+    /**
+     * @brief Get the rows of all states.
+     * @returns Pointer to the first value of the first row.
+     */
+    const double* getRows() const;
+
+    /**
+     * @brief Get the time of a state.
+     * @param[in] state Index of the state.
+     * @returns Time in s.
+     */
+    double getTime(std::int64_t state) const;
+
+    /**
+     * @brief Get the pressures of a state.
+     * @param[in] state Index of the state.
+     * @returns Pointer to the pressure of each node column in Pa.
+     */
+    const double* getPressures(std::int64_t state) const;
+
+    /**
+     * @brief Get the flow rates of a state.
+     * @param[in] state Index of the state.
+     * @returns Pointer to the flow rate of each edge column in m^3/s.
+     */
+    const double* getFlowRates(std::int64_t state) const;
+
+    /**
+     * @brief Get the droplet positions of all states.
+     * @returns The droplet positions, which are empty if the file has no droplet section.
+     */
+    const BinaryDropletPositions& getDropletPositions() const;
+
+    /**
+     * @brief Get the mixture positions of all states.
+     * @returns The mixture positions, which are empty if the file has no mixture section.
+     */
+    const BinaryMixturePositions& getMixturePositions() const;
+};
+
+}   // namespace porting
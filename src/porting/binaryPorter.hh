@@ -0,0 +1,305 @@
+#include "binaryPorter.h"
+
+namespace porting {
+
+inline void writeBinaryHeader(std::ostream& file, std::int64_t nStates, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns) {
+    std::vector<std::int64_t> header = { nStates, static_cast<std::int64_t>(nodeColumns.size()), static_cast<std::int64_t>(edgeColumns.size()) };
+    header.insert(header.end(), nodeColumns.ids.begin(), nodeColumns.ids.end());
+    header.insert(header.end(), edgeColumns.ids.begin(), edgeColumns.ids.end());
+    file.write("MMFTRES1", 8);
+    file.write(reinterpret_cast<const char*>(header.data()), header.size() * sizeof(std::int64_t));
+}
+
+template<typename T>
+void writeBinaryRow(std::ostream& file, result::State<T>* state, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns, std::vector<double>& row) {
+    // values that are missing in the state are NaN
+    row.assign(1 + nodeColumns.size() + edgeColumns.size(), std::numeric_limits<double>::quiet_NaN());
+    row[0] = static_cast<double>(state->getTime());
+    for (auto& [nodeId, pressure] : state->getPressures()) {
+        std::size_t column = nodeColumns.find(nodeId);
+        if (column == result::ColumnIndex::npos) {
+            throw std::invalid_argument("Node " + std::to_string(nodeId) + " is not part of the header of the binary result.");
+        }
+        row[1 + column] = static_cast<double>(pressure);
+    }
+    for (auto& [edgeId, flowRate] : state->getFlowRates()) {
+        std::size_t column = edgeColumns.find(edgeId);
+        if (column == result::ColumnIndex::npos) {
+            throw std::invalid_argument("Edge " + std::to_string(edgeId) + " is not part of the header of the binary result.");
+        }
+        row[1 + nodeColumns.size() + column] = static_cast<double>(flowRate);
+    }
+    file.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(double));
+}
+
+template<typename V>
+void writeBinaryArray(std::ostream& file, const std::vector<V>& values) {
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(V));
+}
+
+template<typename T>
+void resultToBinary(std::string file_, sim::Simulation<T>* simulation) {
+    std::ofstream file(file_, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open the file " + file_ + " for the result.");
+    }
+    auto const& states = simulation->getSimulationResults()->getStates();
+
+    // the columns contain the nodes and edges of all states in ascending order of their ids
+    result::ColumnIndex nodeColumns;
+    result::ColumnIndex edgeColumns;
+    states.getColumns(nodeColumns, edgeColumns);
+    writeBinaryHeader(file, states.size(), nodeColumns, edgeColumns);
+
+    // droplet and mixture positions are collected for their sections, in ascending order of the droplet and channel ids
+    std::vector<std::int64_t> dropletStates, dropletIds, boundaryOffsets = { 0 }, channelOffsets = { 0 };
+    std::vector<std::int64_t> boundaryChannels, volumeTowardsNodeA, channelIds;
+    std::vector<double> boundaryPositions;
+    std::vector<std::int64_t> mixtureStates, mixtureChannels, mixtureIds;
+    std::vector<double> mixtureStarts, mixtureEnds;
+
+    std::vector<double> row;
+    std::int64_t index = 0;
+    for (auto const& state : states) {
+        writeBinaryRow(file, state.get(), nodeColumns, edgeColumns, row);
+
+        std::vector<int> keys;
+        for (auto& [dropletId, position] : state->getDropletPositions()) {
+            keys.push_back(dropletId);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (int dropletId : keys) {
+            auto& position = state->getDropletPositions().at(dropletId);
+            dropletStates.push_back(index);
+            dropletIds.push_back(dropletId);
+            for (auto& boundary : position.boundaries) {
+                boundaryChannels.push_back(boundary.getChannelPosition().getChannel()->getId());
+                volumeTowardsNodeA.push_back(boundary.isVolumeTowardsNodeA());
+                boundaryPositions.push_back(static_cast<double>(boundary.getChannelPosition().getPosition()));
+            }
+            channelIds.insert(channelIds.end(), position.channelIds.begin(), position.channelIds.end());
+            boundaryOffsets.push_back(boundaryChannels.size());
+            channelOffsets.push_back(channelIds.size());
+        }
+
+        keys.clear();
+        for (auto& [channelId, positions] : state->getMixturePositions()) {
+            keys.push_back(channelId);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (int channelId : keys) {
+            for (auto& position : state->getMixturePositions().at(channelId)) {
+                mixtureStates.push_back(index);
+                mixtureChannels.push_back(channelId);
+                mixtureIds.push_back(position.mixtureId);
+                mixtureStarts.push_back(static_cast<double>(position.position1));
+                mixtureEnds.push_back(static_cast<double>(position.position2));
+            }
+        }
+        index++;
+    }
+
+    if (!dropletStates.empty()) {
+        file.write("DROPLETS", 8);
+        writeBinaryArray(file, std::vector<std::int64_t>{ static_cast<std::int64_t>(dropletStates.size()),
+                static_cast<std::int64_t>(boundaryChannels.size()), static_cast<std::int64_t>(channelIds.size()) });
+        writeBinaryArray(file, dropletStates);
+        writeBinaryArray(file, dropletIds);
+        writeBinaryArray(file, boundaryOffsets);
+        writeBinaryArray(file, channelOffsets);
+        writeBinaryArray(file, boundaryChannels);
+        writeBinaryArray(file, volumeTowardsNodeA);
+        writeBinaryArray(file, boundaryPositions);
+        writeBinaryArray(file, channelIds);
+    }
+    if (!mixtureStates.empty()) {
+        file.write("MIXTURES", 8);
+        writeBinaryArray(file, std::vector<std::int64_t>{ static_cast<std::int64_t>(mixtureStates.size()) });
+        writeBinaryArray(file, mixtureStates);
+        writeBinaryArray(file, mixtureChannels);
+        writeBinaryArray(file, mixtureIds);
+        writeBinaryArray(file, mixtureStarts);
+        writeBinaryArray(file, mixtureEnds);
+    }
+}
+
+inline BinaryResult::BinaryResult(std::string file) {
+    #ifdef _WIN32
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream.is_open()) {
+        throw std::runtime_error("Could not open the binary result " + file + ".");
+    }
+    stream.seekg(0, std::ios::end);
+    buffer.resize(static_cast<std::size_t>(stream.tellg()));
+    stream.seekg(0, std::ios::beg);
+    stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+    data = buffer.data();
+    size = buffer.size();
+    #else
+    int descriptor = ::open(file.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Could not open the binary result " + file + ".");
+    }
+    struct stat status;
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("Could not read the size of the binary result " + file + ".");
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    if (size > 0) {
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(descriptor);
+            throw std::runtime_error("Could not map the binary result " + file + " into memory.");
+        }
+        data = static_cast<const std::byte*>(mapping);
+    }
+    // the mapping remains valid after the file is closed
+    ::close(descriptor);
+    #endif
+
+    try {
+        parse();
+    } catch (...) {
+        #ifndef _WIN32
+        if (data != nullptr) {
+            ::munmap(const_cast<std::byte*>(data), size);
+        }
+        #endif
+        throw;
+    }
+}
+
+inline BinaryResult::~BinaryResult() {
+    #ifndef _WIN32
+    if (data != nullptr) {
+        ::munmap(const_cast<std::byte*>(data), size);
+    }
+    #endif
+}
+
+template<typename V>
+const V* BinaryResult::take(std::size_t& offset, std::int64_t count) const {
+    if (count < 0 || static_cast<std::size_t>(count) > (size - offset) / sizeof(V)) {
+        throw std::runtime_error("The binary result is truncated.");
+    }
+    const V* values = reinterpret_cast<const V*>(data + offset);
+    offset += count * sizeof(V);
+    return values;
+}
+
+inline void BinaryResult::parse() {
+    std::size_t offset = 0;
+    if (std::memcmp(take<char>(offset, 8), "MMFTRES1", 8) != 0) {
+        throw std::runtime_error("The file is not a binary result.");
+    }
+    const std::int64_t* counts = take<std::int64_t>(offset, 3);
+    nStates = counts[0];
+    nNodes = counts[1];
+    nEdges = counts[2];
+    nodeIds = take<std::int64_t>(offset, nNodes);
+    edgeIds = take<std::int64_t>(offset, nEdges);
+
+    // A BinarySink that was not flushed at the end of its simulation, e.g., after a crash, leaves the number of states of
+    // its last flush (or 0) in the header. Its rows are not followed by a section, hence the states are counted from the
+    // size of the file instead, and an incomplete last row is ignored.
+    const std::size_t rowBytes = getRowSize() * sizeof(double);
+    const std::size_t storedStates = (size - offset) / rowBytes;
+    if (nStates >= 0 && static_cast<std::size_t>(nStates) < storedStates) {
+        const std::size_t end = offset + nStates * rowBytes;
+        const bool section = size - end >= 8 && (std::memcmp(data + end, "DROPLETS", 8) == 0 || std::memcmp(data + end, "MIXTURES", 8) == 0);
+        if (!section) {
+            nStates = storedStates;
+            rows = take<double>(offset, nStates * static_cast<std::int64_t>(getRowSize()));
+            return;
+        }
+    }
+    rows = take<double>(offset, nStates * static_cast<std::int64_t>(getRowSize()));
+
+    while (offset < size) {
+        std::string tag(take<char>(offset, 8), 8);
+        if (tag == "DROPLETS") {
+            const std::int64_t* sizes = take<std::int64_t>(offset, 3);
+            dropletPositions.size = sizes[0];
+            dropletPositions.nBoundaries = sizes[1];
+            dropletPositions.nChannels = sizes[2];
+            dropletPositions.states = take<std::int64_t>(offset, sizes[0]);
+            dropletPositions.dropletIds = take<std::int64_t>(offset, sizes[0]);
+            dropletPositions.boundaryOffsets = take<std::int64_t>(offset, sizes[0] + 1);
+            dropletPositions.channelOffsets = take<std::int64_t>(offset, sizes[0] + 1);
+            dropletPositions.boundaryChannels = take<std::int64_t>(offset, sizes[1]);
+            dropletPositions.volumeTowardsNodeA = take<std::int64_t>(offset, sizes[1]);
+            dropletPositions.boundaryPositions = take<double>(offset, sizes[1]);
+            dropletPositions.channelIds = take<std::int64_t>(offset, sizes[2]);
+        } else if (tag == "MIXTURES") {
+            const std::int64_t* sizes = take<std::int64_t>(offset, 1);
+            mixturePositions.size = sizes[0];
+            mixturePositions.states = take<std::int64_t>(offset, sizes[0]);
+            mixturePositions.channelIds = take<std::int64_t>(offset, sizes[0]);
+            mixturePositions.mixtureIds = take<std::int64_t>(offset, sizes[0]);
+            mixturePositions.starts = take<double>(offset, sizes[0]);
+            mixturePositions.ends = take<double>(offset, sizes[0]);
+        } else {
+            throw std::runtime_error("Unknown section " + tag + " in the binary result.");
+        }
+    }
+}
+
+inline std::int64_t BinaryResult::getNumberOfStates() const {
+    return nStates;
+}
+
+inline std::int64_t BinaryResult::getNumberOfNodes() const {
+    return nNodes;
+}
+
+inline std::int64_t BinaryResult::getNumberOfEdges() const {
+    return nEdges;
+}
+
+inline const std::int64_t* BinaryResult::getNodeIds() const {
+    return nodeIds;
+}
+
+inline const std::int64_t* BinaryResult::getEdgeIds() const {
+    return edgeIds;
+}
+
+inline std::size_t BinaryResult::getRowSize() const {
+    return 1 + nNodes + nEdges;
+}
+
+inline const double* BinaryResult::getRows() const {
+    return rows;
+}
+
+inline double BinaryResult::getTime(std::int64_t state) const {
+    if (state < 0 || state >= nStates) {
+        throw std::out_of_range("State " + std::to_string(state) + " does not exist.");
+    }
+    return rows[state * getRowSize()];
+}
+
+inline const double* BinaryResult::getPressures(std::int64_t state) const {
+    if (state < 0 || state >= nStates) {
+        throw std::out_of_range("State " + std::to_string(state) + " does not exist.");
+    }
+    return rows + state * getRowSize() + 1;
+}
+
+inline const double* BinaryResult::getFlowRates(std::int64_t state) const {
+    if (state < 0 || state >= nStates) {
+        throw std::out_of_range("State " + std::to_string(state) + " does not exist.");
+    }
+    return rows + state * getRowSize() + 1 + nNodes;
+}
+
+inline const BinaryDropletPositions& BinaryResult::getDropletPositions() const {
+    return dropletPositions;
+}
+
+inline const BinaryMixturePositions& BinaryResult::getMixturePositions() const {
+    return mixturePositions;
+}
+
+}   // namespace porting
@@ -75,6 +75,8 @@ void simulationFromJSON(json jsonString, arch::Network<T>* network_, sim::Simula
     sim::Type simType = readType<T>(jsonString, simulation);
     int activeFixture = readActiveFixture<T>(jsonString);
     simulation.setFixtureId(activeFixture);
+    readStateStorage<T>(jsonString, simulation);
+    readStateSinks<T>(jsonString, simulation);
 
     simulation.setNetwork(network_);
 
@@ -168,18 +170,15 @@ nlohmann::ordered_json resultToJSON(sim::Simulation<T>* simulation) {
     auto jsonResult = ordered_json::object();
     auto jsonStates = ordered_json::array();
 
-    for (auto const& state : simulation->getSimulationResults()->getStates()) {
-        auto jsonState = ordered_json::object();
-        jsonState["time"] = state->getTime();
-        jsonState["nodes"] = writePressures(state.get());
-        jsonState["channels"] = writeChannels(state.get());
-        if (simulation->getPlatform() == sim::Platform::Continuous && simulation->getType() == sim::Type::Hybrid) {
-            jsonState["modules"] = writeModules(state.get());
-        }
-        if (simulation->getPlatform() == sim::Platform::BigDroplet && simulation->getType() == sim::Type::Abstract) {
-            jsonState["bigDroplets"] = writeDroplets(state.get(), simulation);
-        }
-        jsonStates.push_back(jsonState);
+    // the nodes and channels are written in the order of their columns, which are added in ascending order of the ids
+    // in the same pass over the states that writes them
+    auto const& states = simulation->getSimulationResults()->getStates();
+    result::ColumnIndex nodeColumns;
+    result::ColumnIndex edgeColumns;
+    for (auto const& state : states) {
+        nodeColumns.add(state->getPressures());
+        edgeColumns.add(state->getFlowRates());
+        jsonStates.push_back(writeState(state.get(), simulation, nodeColumns, edgeColumns));
     }
 
     jsonResult["fixture"] = simulation->getFixtureId();
@@ -175,6 +175,22 @@ void readResistanceModel (json jsonString, sim::Simulation<T>& simulation);
 template<typename T>
 void readMixingModel (json jsonString, sim::Simulation<T>& simulation);
 
+/**
+ * @brief Set how the states of the simulation result are stored, as defined by the json string
+ * @param[in] jsonString json string
+ * @param[in] simulation simulation object
+*/
+template<typename T>
+void readStateStorage (json jsonString, sim::Simulation<T>& simulation);
+
+/**
+ * @brief Construct and add the sinks to which the states are streamed, and set the number of states that are kept in memory, as defined by the json string
+ * @param[in] jsonString json string
+ * @param[in] simulation simulation object
+*/
+template<typename T>
+void readStateSinks (json jsonString, sim::Simulation<T>& simulation);
+
 /**
  * @brief Returns the id of the active fixture as defined in the json string
  * @returns The id of the active fixture
@@ -249,6 +249,9 @@ void readSimulators(json jsonString, sim::Simulation<T>& simulation, arch::Netwo
         } else {
             vtkFolder = "./tmp/";
         }
+        if (jsonString["simulation"]["settings"].contains("threads")) {
+            simulation.setCfdThreads(jsonString["simulation"]["settings"]["threads"]);
+        }
         for (auto& simulator : jsonString["simulation"]["settings"]["simulators"]) {
             std::string name = simulator["name"];
             std::string stlFile = simulator["stlFile"];
@@ -268,9 +271,16 @@ void readSimulators(json jsonString, sim::Simulation<T>& simulation, arch::Netwo
 
             if(simulator["Type"] == "LBM")
             {
-                auto simulator = simulation.addLbmSimulator(name, stlFile, network->getModule(moduleId), Openings, charPhysLength, 
+                auto lbmSimulator = simulation.addLbmSimulator(name, stlFile, network->getModule(moduleId), Openings, charPhysLength, 
                                                             charPhysVelocity, resolution, epsilon, tau);
-                simulator->setVtkFolder(vtkFolder);
+                lbmSimulator->setVtkFolder(vtkFolder);
+                if (simulator.contains("residualTolerance")) {
+                    lbmSimulator->setResidualTolerance(simulator["residualTolerance"], simulator.value("residualInterval", 5));
+                }
+                if (jsonString["simulation"]["settings"].contains("vtkInterval") || jsonString["simulation"]["settings"].contains("vtkQueue")) {
+                    lbmSimulator->setVtkOutput(jsonString["simulation"]["settings"].value("vtkInterval", 1000),
+                                               jsonString["simulation"]["settings"].value("vtkQueue", 0));
+                }
             }
             else if (simulator["Type"] == "Mixing")
             {
@@ -278,9 +288,12 @@ void readSimulators(json jsonString, sim::Simulation<T>& simulation, arch::Netwo
                 for (auto& [specieId, speciePtr] : simulation.getSpecies()) {
                     species.try_emplace(specieId, speciePtr.get());
                 }
-                auto simulator = simulation.addLbmMixingSimulator(name, stlFile, network->getModule(moduleId), species,
+                auto mixingSimulator = simulation.addLbmMixingSimulator(name, stlFile, network->getModule(moduleId), species,
                                                             Openings, charPhysLength, charPhysVelocity, resolution, epsilon, tau);
-                simulator->setVtkFolder(vtkFolder);
+                mixingSimulator->setVtkFolder(vtkFolder);
+                if (simulator.contains("adThreads")) {
+                    mixingSimulator->setAdThreads(simulator["adThreads"]);
+                }
             }
             else if (simulator["Type"] == "Organ")
             {
@@ -344,7 +357,7 @@ void readUpdateScheme(json jsonString, sim::Simulation<T>& simulation) {
                             int theta = simulator["theta"];
                             for (auto& opening : simulator["Openings"]) {
                                 alpha.try_emplace(opening["node"], simulator["alpha"][nodeCounter]);
-                                alpha.try_emplace(opening["node"], simulator["beta"][nodeCounter]);
+                                beta.try_emplace(opening["node"], simulator["beta"][nodeCounter]);
                                 nodeCounter++;
                             }
                             simulation.setNaiveHybridScheme(moduleCounter, alpha, beta, theta);
@@ -356,6 +369,33 @@ void readUpdateScheme(json jsonString, sim::Simulation<T>& simulation) {
                 }
             }
         }
+        else if (jsonString["simulation"]["updateScheme"]["scheme"] == "Aitken") {
+            if (jsonString["simulation"]["updateScheme"].contains("alpha") && 
+                jsonString["simulation"]["updateScheme"].contains("beta") &&
+                jsonString["simulation"]["updateScheme"].contains("theta")) 
+            {
+                T alpha = jsonString["simulation"]["updateScheme"]["alpha"];
+                T beta = jsonString["simulation"]["updateScheme"]["beta"];
+                int theta = jsonString["simulation"]["updateScheme"]["theta"];
+                simulation.setAitkenHybridScheme(alpha, beta, theta);
+                return;
+            } 
+            else {
+                int moduleCounter = 0;
+                for (auto& simulator : jsonString["simulation"]["settings"]["simulators"]) {
+                    if (simulator.contains("alpha") && simulator.contains("beta") && simulator.contains("theta") &&
+                        simulator["alpha"].is_number() && simulator["beta"].is_number()) {
+                        T alpha = simulator["alpha"];
+                        T beta = simulator["beta"];
+                        int theta = simulator["theta"];
+                        simulation.setAitkenHybridScheme(moduleCounter, alpha, beta, theta);
+                        moduleCounter++;
+                    } else {
+                        throw std::invalid_argument("alpha, beta or theta values are either not or ill-defined for Aitken update scheme.");
+                    }
+                }
+            }
+        }
     }
 }
 
@@ -440,6 +480,54 @@ void readMixingModel(json jsonString, sim::Simulation<T>& simulation) {
     simulation.setMixingModel(mixingModel);
 }
 
+template<typename T>
+void readStateStorage(json jsonString, sim::Simulation<T>& simulation) {
+    if (!jsonString["simulation"].contains("stateStorage")) {
+        return;
+    }
+    result::StateStorage storage;
+    if (jsonString["simulation"]["stateStorage"] == "Full") {
+        storage = result::StateStorage::Full;
+    } else if (jsonString["simulation"]["stateStorage"] == "Delta") {
+        storage = result::StateStorage::Delta;
+    } else if (jsonString["simulation"]["stateStorage"] == "Columnar") {
+        storage = result::StateStorage::Columnar;
+    } else {
+        throw std::invalid_argument("Invalid state storage. Options are:\nFull\nDelta\nColumnar");
+    }
+    int keyframeInterval = 16;
+    if (jsonString["simulation"].contains("keyframeInterval")) {
+        keyframeInterval = jsonString["simulation"]["keyframeInterval"];
+    }
+    simulation.getSimulationResults()->setStateStorage(storage, keyframeInterval);
+}
+
+template<typename T>
+void readStateSinks(json jsonString, sim::Simulation<T>& simulation) {
+    if (jsonString["simulation"].contains("stateSinks")) {
+        for (auto& sink : jsonString["simulation"]["stateSinks"]) {
+            if (!sink.contains("format") || !sink.contains("file")) {
+                throw std::invalid_argument("Please define the format and file of each state sink.");
+            }
+            std::string file = sink["file"];
+            if (sink["format"] == "JsonLines") {
+                simulation.addStateSink(std::make_shared<JsonLinesSink<T>>(file));
+            } else if (sink["format"] == "Binary") {
+                simulation.addStateSink(std::make_shared<BinarySink<T>>(file));
+            } else {
+                throw std::invalid_argument("Invalid state sink format. Options are:\nJsonLines\nBinary");
+            }
+        }
+    }
+    if (jsonString["simulation"].contains("retainedStates")) {
+        int retainedStates = jsonString["simulation"]["retainedStates"];
+        if (retainedStates < 0) {
+            throw std::invalid_argument("The number of retained states must be non-negative.");
+        }
+        simulation.getSimulationResults()->setRetainedStates(retainedStates);
+    }
+}
+
 template<typename T>
 int readActiveFixture(json jsonString) {
     unsigned int activeFixture = 0;
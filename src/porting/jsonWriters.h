@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -28,25 +31,38 @@ namespace result {
 template<typename T>
 class State;
 
+struct ColumnIndex;
+
 }   // namespace result
 
 namespace porting {
 
 /**
- * @brief Write the pressures at the nodes in a network at a state (timestamp) of the simulation
+ * @brief Order the values of a map by the columns of their ids
+ * @param[in] values map of the values <id, value>
+ * @param[in] index columns of the ids, which must contain every id of the map
+ * @return Pointer to the value of each column, or nullptr if the map has no value for the column
+*/
+template<typename V>
+std::vector<const V*> orderByColumns (const std::unordered_map<int, V>& values, const result::ColumnIndex& index);
+
+/**
+ * @brief Write the pressures at the nodes in a network at a state (timestamp) of the simulation, in the order of the node columns
  * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] nodeColumns columns of the nodes
  * @return The json string containing the result
 */
 template<typename T>
-auto writePressures (result::State<T>* state);
+auto writePressures (result::State<T>* state, const result::ColumnIndex& nodeColumns);
 
 /**
- * @brief Write the flow rates in the channels of a network at a state (timestamp) of the simulation
+ * @brief Write the flow rates and mixture positions in the channels of a network at a state (timestamp) of the simulation, in the order of the edge columns
  * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] edgeColumns columns of the edges
  * @return The json string containing the result
 */
 template<typename T>
-auto writeChannels (result::State<T>* state);
+auto writeChannels (result::State<T>* state, const result::ColumnIndex& edgeColumns);
 
 /**
  * @brief Write the location of the vtk results of a module at a state (timestamp) of the simulation
@@ -65,6 +81,17 @@ auto writeModules (result::State<T>* state);
 template<typename T>
 auto writeDroplets (result::State<T>* state, sim::Simulation<T>* simulation);
 
+/**
+ * @brief Write a state (timestamp) of the simulation, with the values that are relevant for the platform and type of the simulation
+ * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] simulation pointer to the simulation of which the results are written
+ * @param[in] nodeColumns columns of the nodes, which define the order of the nodes
+ * @param[in] edgeColumns columns of the edges, which define the order of the channels
+ * @return The json string containing the result
+*/
+template<typename T>
+auto writeState (result::State<T>* state, sim::Simulation<T>* simulation, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns);
+
 /**
  * @brief Write set of fluids of the simulation
  * @param[in] simulation pointer to the simulation of which the results are written
@@ -2,40 +2,52 @@
 
 namespace porting {
 
+template<typename V>
+std::vector<const V*> orderByColumns(const std::unordered_map<int, V>& values, const result::ColumnIndex& index) {
+    std::vector<const V*> ordered(index.size(), nullptr);
+    for (auto& [id, value] : values) {
+        std::size_t column = index.find(id);
+        if (column == result::ColumnIndex::npos) {
+            throw std::invalid_argument("Id " + std::to_string(id) + " has no column in the result.");
+        }
+        ordered[column] = &value;
+    }
+    return ordered;
+}
+
 template<typename T>
-auto writePressures(result::State<T>* state) {
+auto writePressures(result::State<T>* state, const result::ColumnIndex& nodeColumns) {
     auto nodes = ordered_json::array();
-    auto const& pressures = state->getPressures();
-    for (auto& [key, pressure] : pressures) {
-        nodes.push_back({{"pressure", pressure}});
+    for (const T* pressure : orderByColumns(state->getPressures(), nodeColumns)) {
+        if (pressure != nullptr) {
+            nodes.push_back({{"pressure", *pressure}});
+        }
     }
     return nodes;
 }
 
 template<typename T>
-auto writeChannels(result::State<T>* state) {      
+auto writeChannels(result::State<T>* state, const result::ColumnIndex& edgeColumns) {      
     auto channels = ordered_json::array();
-    auto const& flowRates = state->getFlowRates();
-    if (state->getMixturePositions().empty()) {
-        for (auto& [key, flowRate] : flowRates) {
-            channels.push_back({{"flowRate", flowRate}});
+    auto flowRates = orderByColumns(state->getFlowRates(), edgeColumns);
+    auto mixturePositions = orderByColumns(state->getMixturePositions(), edgeColumns);
+    for (std::size_t column = 0; column < edgeColumns.size(); ++column) {
+        if (flowRates[column] == nullptr) {
+            continue;
         }
-    } else if ( !state->getMixturePositions().empty() ) {
-        for (long unsigned int i=0; i<flowRates.size(); ++i) {
-            auto channel = ordered_json::object();
-            channel["flowRate"] = flowRates.at(i);
-            if ( state->getMixturePositions().count(i) ) {
-                channel["mixturePositions"] = ordered_json::array();
-                for (auto& position : state->getMixturePositions().at(i)) {
-                    channel["mixturePositions"].push_back({
-                        {"mixture", position.mixtureId},
-                        {"start", position.position1},
-                        {"end", position.position2}
-                    });
-                }
+        auto channel = ordered_json::object();
+        channel["flowRate"] = *flowRates[column];
+        if (mixturePositions[column] != nullptr) {
+            channel["mixturePositions"] = ordered_json::array();
+            for (auto& position : *mixturePositions[column]) {
+                channel["mixturePositions"].push_back({
+                    {"mixture", position.mixtureId},
+                    {"start", position.position1},
+                    {"end", position.position2}
+                });
             }
-            channels.push_back(channel);
         }
+        channels.push_back(channel);
     }
     return channels;
 }
@@ -87,6 +99,21 @@ auto writeDroplets(result::State<T>* state, sim::Simulation<T>* simulation) {
     return BigDroplets;
 }
 
+template<typename T>
+auto writeState(result::State<T>* state, sim::Simulation<T>* simulation, const result::ColumnIndex& nodeColumns, const result::ColumnIndex& edgeColumns) {
+    auto jsonState = ordered_json::object();
+    jsonState["time"] = state->getTime();
+    jsonState["nodes"] = writePressures(state, nodeColumns);
+    jsonState["channels"] = writeChannels(state, edgeColumns);
+    if (simulation->getPlatform() == sim::Platform::Continuous && simulation->getType() == sim::Type::Hybrid) {
+        jsonState["modules"] = writeModules(state);
+    }
+    if (simulation->getPlatform() == sim::Platform::BigDroplet && simulation->getType() == sim::Type::Abstract) {
+        jsonState["bigDroplets"] = writeDroplets(state, simulation);
+    }
+    return jsonState;
+}
+
 template<typename T>
 auto writeFluids(sim::Simulation<T>* simulation) {      
     auto Fluids = ordered_json::array();
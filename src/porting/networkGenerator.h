@@ -0,0 +1,120 @@
+/**
+ * @file networkGenerator.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace porting {
+
+/**
+ * @brief Enum to specify the topology of a generated network.
+*/
+enum class NetworkTopology {
+    Grid,           ///< Rectangular grid of nodes, connected to their horizontal and vertical neighbours.
+    Ladder,         ///< Two parallel rails of nodes, connected by rungs.
+    Tree,           ///< Binary bifurcation tree, with an outlet at every leaf.
+    Random          ///< Random planar network on a jittered grid, with a random spanning tree and random additional channels.
+};
+
+/**
+ * @brief Struct that contains the parameters of a generated network and of the simulation on it.
+*/
+template<typename T>
+struct GeneratorSettings {
+    NetworkTopology topology = NetworkTopology::Grid;   ///< Topology of the network.
+    int nNodes = 100;                                   ///< Number of nodes of the topology, without the ground nodes of the inlet and the outlets.
+    T channelWidth = 1e-4;                              ///< Width of all channels in m.
+    T channelHeight = 3e-5;                             ///< Height of all channels in m.
+    T spacing = 1e-3;                                   ///< Distance between neighbouring nodes in m.
+    unsigned int seed = 0;                              ///< Seed of the random topology.
+    std::string platform = "Continuous";                ///< Platform of the simulation (Continuous, BigDroplet or Mixing).
+    std::string resistanceModel = "Rectangular";        ///< Resistance model of the simulation.
+    std::string mixingModel = "Instantaneous";          ///< Mixing model of a Mixing simulation.
+    T flowRate = 3e-11;                                 ///< Flow rate of the pump at the inlet in m^3/s.
+    int nDroplets = 1;                                  ///< Number of droplets of a BigDroplet simulation.
+    T dropletVolume = 4.5e-13;                          ///< Volume of the droplets in m^3.
+    int nMixtureInjections = 1;                         ///< Number of mixture injections of a Mixing simulation.
+};
+
+/**
+ * @brief Struct that contains the node positions and the channels of a generated topology.
+*/
+template<typename T>
+struct NetworkLayout {
+    std::vector<std::array<T,2>> positions;     ///< Positions of the nodes in m.
+    std::vector<std::pair<int, int>> edges;     ///< Channels between the nodes, as pairs of indices into positions.
+    std::vector<int> outlets;                   ///< Nodes that are connected to a ground node.
+};
+
+/**
+ * @brief Get the topology of a generated network from its name
+ * @param[in] name name of the topology (grid, ladder, tree or random)
+ * @returns NetworkTopology topology
+*/
+NetworkTopology topologyFromString(const std::string& name);
+
+/**
+ * @brief Generate the layout of a grid of nodes with as many columns as rows
+ * @param[in] settings settings of the generated network
+ * @returns NetworkLayout layout
+*/
+template<typename T>
+NetworkLayout<T> generateGrid(const GeneratorSettings<T>& settings);
+
+/**
+ * @brief Generate the layout of a ladder with nNodes/2 rungs. Throws if nNodes is odd, as one node could not be placed.
+ * @param[in] settings settings of the generated network
+ * @returns NetworkLayout layout
+*/
+template<typename T>
+NetworkLayout<T> generateLadder(const GeneratorSettings<T>& settings);
+
+/**
+ * @brief Generate the layout of a binary bifurcation tree
+ * @param[in] settings settings of the generated network
+ * @returns NetworkLayout layout
+*/
+template<typename T>
+NetworkLayout<T> generateTree(const GeneratorSettings<T>& settings);
+
+/**
+ * @brief Generate the layout of a random planar network, which is reproducible for a given seed. Apart from the inlet and
+ * the outlet, every node has at least two channels.
+ * @param[in] settings settings of the generated network
+ * @returns NetworkLayout layout
+*/
+template<typename T>
+NetworkLayout<T> generateRandom(const GeneratorSettings<T>& settings);
+
+/**
+ * @brief Generate a network in the JSON format of networkFromJSON. Node 0 is a ground node that is connected to the
+ * first node of the topology by channel 0, the inlet. The channels of the topology follow, and the outlets are connected
+ * to separate ground nodes (droplet sinks) by the last channels.
+ * @param[in] settings settings of the generated network
+ * @returns json json string containing the network
+*/
+template<typename T>
+nlohmann::json generateNetwork(const GeneratorSettings<T>& settings);
+
+/**
+ * @brief Generate an abstract simulation on a generated network in the JSON format of networkFromJSON and simulationFromJSON.
+ * The inlet channel carries a flow rate pump. Droplets and mixture injections are distributed evenly over the channels of the topology.
+ * @param[in] settings settings of the generated network and simulation
+ * @returns json json string containing the network and the simulation
+*/
+template<typename T>
+nlohmann::json generateSimulation(const GeneratorSettings<T>& settings);
+
+}   // namespace porting
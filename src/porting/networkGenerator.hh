@@ -0,0 +1,282 @@
+#include "networkGenerator.h"
+
+namespace porting {
+
+using json = nlohmann::json;
+
+inline NetworkTopology topologyFromString(const std::string& name) {
+    if (name == "grid") {
+        return NetworkTopology::Grid;
+    } else if (name == "ladder") {
+        return NetworkTopology::Ladder;
+    } else if (name == "tree") {
+        return NetworkTopology::Tree;
+    } else if (name == "random") {
+        return NetworkTopology::Random;
+    }
+    throw std::invalid_argument("Topology is invalid. The following topologies are possible:\ngrid\nladder\ntree\nrandom");
+}
+
+template<typename T>
+NetworkLayout<T> generateGrid(const GeneratorSettings<T>& settings) {
+    NetworkLayout<T> layout;
+    int nCols = static_cast<int>(std::ceil(std::sqrt(settings.nNodes)));
+    for (int k = 0; k < settings.nNodes; ++k) {
+        layout.positions.push_back({ (k % nCols) * settings.spacing, (k / nCols) * settings.spacing });
+        bool right = (k + 1) % nCols != 0 && k + 1 < settings.nNodes;
+        bool down = k + nCols < settings.nNodes;
+        if (right) {
+            layout.edges.emplace_back(k, k + 1);
+        }
+        if (down) {
+            layout.edges.emplace_back(k, k + nCols);
+        }
+        if (right && down && k + nCols + 1 >= settings.nNodes && k + 1 < nCols) {
+            // with two rows, the last node of the first row has no neighbour above, nor below the incomplete last row
+            layout.edges.emplace_back(k + 1, k + nCols);
+        }
+    }
+    layout.outlets.push_back(settings.nNodes - 1);
+    return layout;
+}
+
+template<typename T>
+NetworkLayout<T> generateLadder(const GeneratorSettings<T>& settings) {
+    if (settings.nNodes < 2 || settings.nNodes % 2 != 0) {
+        throw std::invalid_argument("A ladder requires an even number of at least 2 nodes, but " + std::to_string(settings.nNodes) + " nodes were requested.");
+    }
+
+    NetworkLayout<T> layout;
+    int nRungs = settings.nNodes / 2;
+    // node 2i is on the upper rail and node 2i+1 on the lower rail
+    for (int i = 0; i < nRungs; ++i) {
+        layout.positions.push_back({ i * settings.spacing, 0.0 });
+        layout.positions.push_back({ i * settings.spacing, -settings.spacing });
+        layout.edges.emplace_back(2*i, 2*i + 1);
+        if (i > 0) {
+            layout.edges.emplace_back(2*i - 2, 2*i);
+            layout.edges.emplace_back(2*i - 1, 2*i + 1);
+        }
+    }
+    layout.outlets.push_back(2*nRungs - 1);
+    return layout;
+}
+
+template<typename T>
+NetworkLayout<T> generateTree(const GeneratorSettings<T>& settings) {
+    NetworkLayout<T> layout;
+    // node k has the children 2k+1 and 2k+2, the leaves of the deepest level are one spacing apart
+    int maxDepth = static_cast<int>(std::log2(settings.nNodes));
+    for (int k = 0; k < settings.nNodes; ++k) {
+        int depth = static_cast<int>(std::log2(k + 1));
+        int index = k + 1 - (1 << depth);
+        T width = (1 << (maxDepth - depth)) * settings.spacing;
+        layout.positions.push_back({ depth * settings.spacing, (index + 0.5) * width });
+        for (int child : { 2*k + 1, 2*k + 2 }) {
+            if (child < settings.nNodes) {
+                layout.edges.emplace_back(k, child);
+            }
+        }
+        if (2*k + 1 >= settings.nNodes) {
+            layout.outlets.push_back(k);
+        }
+    }
+    return layout;
+}
+
+template<typename T>
+NetworkLayout<T> generateRandom(const GeneratorSettings<T>& settings) {
+    if (settings.nNodes < 2) {
+        throw std::invalid_argument("A random network requires at least 2 nodes, but " + std::to_string(settings.nNodes) + " nodes were requested.");
+    }
+
+    NetworkLayout<T> layout;
+    std::mt19937 generator(settings.seed);
+    std::uniform_real_distribution<T> jitter(-0.25 * settings.spacing, 0.25 * settings.spacing);
+    std::bernoulli_distribution addEdge(0.5);
+
+    // candidate channels of a jittered grid with one diagonal per cell, such that no channels cross
+    int nCols = static_cast<int>(std::ceil(std::sqrt(settings.nNodes)));
+    std::vector<std::pair<int, int>> candidates;
+    for (int k = 0; k < settings.nNodes; ++k) {
+        layout.positions.push_back({ (k % nCols) * settings.spacing + jitter(generator),
+                                     (k / nCols) * settings.spacing + jitter(generator) });
+        bool right = (k + 1) % nCols != 0 && k + 1 < settings.nNodes;
+        bool down = k + nCols < settings.nNodes;
+        if (right) {
+            candidates.emplace_back(k, k + 1);
+        }
+        if (down) {
+            candidates.emplace_back(k, k + nCols);
+        }
+        if (right && k + nCols + 1 < settings.nNodes) {
+            if (addEdge(generator)) {
+                candidates.emplace_back(k, k + nCols + 1);
+            } else {
+                candidates.emplace_back(k + 1, k + nCols);
+            }
+        } else if (right && down) {
+            // the cell is cut off by the incomplete last row, its diagonal gives the node at its upper right a second neighbour
+            candidates.emplace_back(k + 1, k + nCols);
+        }
+    }
+
+    // random spanning tree (Kruskal on shuffled candidates) keeps the network connected
+    std::vector<int> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), generator);
+    std::vector<int> parent(settings.nNodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int node) {
+        while (parent[node] != node) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    };
+    std::vector<bool> selected(candidates.size(), false);
+    for (int candidate : order) {
+        int rootA = find(candidates[candidate].first);
+        int rootB = find(candidates[candidate].second);
+        if (rootA != rootB) {
+            parent[rootA] = rootB;
+            selected[candidate] = true;
+        } else {
+            selected[candidate] = addEdge(generator);
+        }
+    }
+
+    // dangling nodes are not allowed, except for the nodes at the inlet and the outlet
+    std::vector<int> degree(settings.nNodes, 0);
+    degree.front()++;
+    degree.back()++;
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        if (selected[candidate]) {
+            degree[candidates[candidate].first]++;
+            degree[candidates[candidate].second]++;
+        }
+    }
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        auto [nodeA, nodeB] = candidates[candidate];
+        if (!selected[candidate] && (degree[nodeA] < 2 || degree[nodeB] < 2)) {
+            selected[candidate] = true;
+            degree[nodeA]++;
+            degree[nodeB]++;
+        }
+    }
+
+    for (int node = 1; node < settings.nNodes - 1; ++node) {
+        if (degree[node] < 2) {
+            throw std::runtime_error("Node " + std::to_string(node) + " of the random network is dangling.");
+        }
+    }
+
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        if (selected[candidate]) {
+            layout.edges.push_back(candidates[candidate]);
+        }
+    }
+    layout.outlets.push_back(settings.nNodes - 1);
+    return layout;
+}
+
+template<typename T>
+json generateNetwork(const GeneratorSettings<T>& settings) {
+    if (settings.nNodes < 2) {
+        throw std::invalid_argument("A generated network requires at least 2 nodes.");
+    }
+
+    NetworkLayout<T> layout;
+    if (settings.topology == NetworkTopology::Grid) {
+        layout = generateGrid(settings);
+    } else if (settings.topology == NetworkTopology::Ladder) {
+        layout = generateLadder(settings);
+    } else if (settings.topology == NetworkTopology::Tree) {
+        layout = generateTree(settings);
+    } else {
+        layout = generateRandom(settings);
+    }
+
+    json jsonString;
+    json& nodes = jsonString["network"]["nodes"];
+    json& channels = jsonString["network"]["channels"];
+    auto addChannel = [&](int node1, int node2) {
+        channels.push_back({{"node1", node1}, {"node2", node2}, {"width", settings.channelWidth}, {"height", settings.channelHeight}});
+    };
+
+    // node 0 is the ground node of the inlet, the nodes of the topology are shifted by one
+    nodes.push_back({{"x", layout.positions[0][0] - settings.spacing}, {"y", layout.positions[0][1]}, {"z", 0.0}, {"ground", true}});
+    for (auto& [x, y] : layout.positions) {
+        nodes.push_back({{"x", x}, {"y", y}, {"z", 0.0}});
+    }
+    addChannel(0, 1);
+    for (auto& [node1, node2] : layout.edges) {
+        addChannel(node1 + 1, node2 + 1);
+    }
+    for (int outlet : layout.outlets) {
+        int groundId = nodes.size();
+        nodes.push_back({{"x", layout.positions[outlet][0] + settings.spacing}, {"y", layout.positions[outlet][1]}, {"z", 0.0}, {"ground", true}, {"sink", true}});
+        addChannel(outlet + 1, groundId);
+    }
+
+    return jsonString;
+}
+
+template<typename T>
+json generateSimulation(const GeneratorSettings<T>& settings) {
+    json jsonString = generateNetwork(settings);
+
+    // the channels of the topology lie between the inlet and the outlet channels
+    int nOutlets = 0;
+    for (auto& node : jsonString["network"]["nodes"]) {
+        if (node.contains("sink")) {
+            nOutlets++;
+        }
+    }
+    int nEdges = jsonString["network"]["channels"].size() - 1 - nOutlets;
+    auto distribute = [&](int count, const std::string& name) {
+        if (count > nEdges) {
+            throw std::invalid_argument("The generated network has only " + std::to_string(nEdges) + " channels for " + std::to_string(count) + " " + name + ".");
+        }
+        std::vector<int> channelIds;
+        for (int i = 0; i < count; ++i) {
+            channelIds.push_back(1 + (i * nEdges) / count);
+        }
+        return channelIds;
+    };
+
+    json& simulation = jsonString["simulation"];
+    simulation["platform"] = settings.platform;
+    simulation["type"] = "Abstract";
+    simulation["resistanceModel"] = settings.resistanceModel;
+    simulation["fluids"].push_back({{"name", "Water"}, {"concentration", 1}, {"density", 1e3}, {"viscosity", 1e-3}});
+    simulation["pumps"].push_back({{"channel", 0}, {"type", "PumpFlowrate"}, {"flowRate", settings.flowRate}});
+    simulation["fixtures"].push_back({{"name", "Setup #1"}, {"phase", 0}});
+    json& fixture = simulation["fixtures"][0];
+
+    if (settings.platform == "BigDroplet") {
+        simulation["fluids"].push_back({{"name", "Oil"}, {"concentration", 1}, {"density", 1e3}, {"viscosity", 3e-3}});
+        fixture["bigDropletInjections"] = json::array();
+        for (int channelId : distribute(settings.nDroplets, "droplets")) {
+            fixture["bigDropletInjections"].push_back({{"fluid", 1}, {"volume", settings.dropletVolume}, {"channel", channelId},
+                                                       {"pos", 0.5}, {"t0", 0.0}, {"deltaT", 0.0}, {"t1", 0.0}});
+        }
+    } else if (settings.platform == "Mixing") {
+        simulation["mixingModel"] = settings.mixingModel;
+        simulation["species"].push_back({{"name", "Oxygen"}, {"diffusivity", 2.3e-9}, {"saturationConcentration", 8.3}, {"molecularSize", 0.0}});
+        simulation["mixtures"].push_back({{"species", {0}}, {"concentrations", {4.0}}});
+        fixture["mixtureInjections"] = json::array();
+        for (int channelId : distribute(settings.nMixtureInjections, "mixture injections")) {
+            fixture["mixtureInjections"].push_back({{"mixture", 0}, {"channel", channelId}, {"t0", 0.0}});
+        }
+    } else if (settings.platform != "Continuous") {
+        throw std::invalid_argument("Platform is invalid. The following platforms can be generated:\nContinuous\nBigDroplet\nMixing");
+    }
+
+    simulation["activeFixture"] = 0;
+    simulation["settings"] = json::object();
+
+    return jsonString;
+}
+
+}   // namespace porting
@@ -0,0 +1,116 @@
+/**
+ * @file parameterSweep.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "../architecture/Network.h"
+#include "../result/Results.h"
+
+using json = nlohmann::json;
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Simulation;
+
+}   // namespace sim
+
+namespace porting {
+
+/**
+ * @brief Struct that contains the parameters of one run of a parameter sweep, which override the values of the definition.
+*/
+template<typename T>
+struct SweepVariant {
+    std::unordered_map<int, T> pressurePumps;   ///< Pressure of the pressure pumps in Pa. <pumpId, pressure>
+    std::unordered_map<int, T> flowRatePumps;   ///< Flow rate of the flow rate pumps in m^3/s. <pumpId, flowRate>
+    std::unordered_map<int, T> injectionTimes;  ///< Injection time of the droplet or mixture injections in s. <injectionId, time>
+};
+
+/**
+ * @brief Struct that contains the compact result of one run of a parameter sweep, i.e., the values of its last state.
+*/
+template<typename T>
+struct SweepResult {
+    std::size_t nStates = 0;    ///< Number of states of the run.
+    T time = 0;                 ///< Time of the last state in s.
+    std::vector<T> pressures;   ///< Pressures of the last state in Pa, in the order of the node ids of the sweep.
+    std::vector<T> flowRates;   ///< Flow rates of the last state in m^3/s, in the order of the edge ids of the sweep.
+    std::string error;          ///< Message of the error that stopped the run, empty if the run succeeded.
+};
+
+/**
+ * @brief Class to run variants of an abstract simulation definition in parallel. The definition is parsed and the network is
+ * built once. Every run simulates its own copy of the network, such that the runs are independent of each other and can
+ * be executed on a pool of threads.
+*/
+template<typename T>
+class ParameterSweep {
+private:
+    json definition;                    ///< Simulation part of the definition, from which the simulation of every run is read.
+    arch::Network<T> network;           ///< Network of the definition, which is copied for every run.
+    result::ColumnIndex nodeColumns;    ///< Columns of the nodes of the compact results.
+    result::ColumnIndex edgeColumns;    ///< Columns of the edges of the compact results.
+    unsigned int nThreads = 0;          ///< Number of threads that execute the runs. 0 uses all hardware threads.
+
+    /**
+     * @brief Simulate one variant of the definition.
+     * @param[in] variant Parameters of the run.
+     * @returns The compact result of the run.
+     */
+    SweepResult<T> simulate(const SweepVariant<T>& variant) const;
+
+public:
+    /**
+     * @brief Constructor of a parameter sweep.
+     * @param[in] definition JSON definition of the network and the abstract simulation.
+     */
+    explicit ParameterSweep(json definition);
+
+    /**
+     * @brief Constructor of a parameter sweep.
+     * @param[in] jsonFile Location of the JSON definition of the network and the abstract simulation.
+     */
+    explicit ParameterSweep(std::string jsonFile);
+
+    /**
+     * @brief Set the number of threads that execute the runs.
+     * @param[in] nThreads Number of threads. 0 uses all hardware threads.
+     */
+    void setThreads(unsigned int nThreads);
+
+    /**
+     * @brief Get the ids of the nodes in the order of the pressures of the results.
+     * @returns Node ids in ascending order.
+     */
+    const std::vector<int>& getNodeIds() const;
+
+    /**
+     * @brief Get the ids of the edges in the order of the flow rates of the results.
+     * @returns Edge ids in ascending order.
+     */
+    const std::vector<int>& getEdgeIds() const;
+
+    /**
+     * @brief Simulate all variants. A run that throws an error does not stop the other runs, its error is stored in its result.
+     * @param[in] variants Parameters of the runs.
+     * @returns The compact result of each run, in the order of the variants.
+     */
+    std::vector<SweepResult<T>> run(const std::vector<SweepVariant<T>>& variants) const;
+};
+
+}   // namespace porting
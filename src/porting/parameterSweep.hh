@@ -0,0 +1,121 @@
+#include "parameterSweep.h"
+
+namespace porting {
+
+template<typename T>
+ParameterSweep<T>::ParameterSweep(json definition_) : network(networkFromJSON<T>(definition_)) {
+    if (!definition_.contains("simulation") || !definition_["simulation"].is_object()) {
+        throw std::invalid_argument("Please define a simulation for the parameter sweep.");
+    }
+    if (definition_["simulation"].contains("type") && definition_["simulation"]["type"] != "Abstract") {
+        throw std::invalid_argument("Parameter sweeps are only supported for Abstract simulations.");
+    }
+
+    // the runs only read the simulation, their network is a copy of the network of the sweep
+    definition["simulation"] = std::move(definition_["simulation"]);
+
+    // concurrent runs must not write to the same files
+    definition["simulation"].erase("stateSinks");
+    definition["simulation"].erase("retainedStates");
+
+    std::vector<int> nodeIds;
+    std::vector<int> edgeIds;
+    for (auto& [nodeId, node] : network.getNodes()) {
+        nodeIds.push_back(nodeId);
+    }
+    for (auto& [channelId, channel] : network.getChannels()) {
+        edgeIds.push_back(channelId);
+    }
+    for (auto& [pumpId, pump] : network.getFlowRatePumps()) {
+        edgeIds.push_back(pumpId);
+    }
+    for (auto& [pumpId, pump] : network.getPressurePumps()) {
+        edgeIds.push_back(pumpId);
+    }
+    nodeColumns.add(std::move(nodeIds));
+    edgeColumns.add(std::move(edgeIds));
+}
+
+template<typename T>
+ParameterSweep<T>::ParameterSweep(std::string jsonFile) : ParameterSweep(json::parse(std::ifstream(jsonFile))) { }
+
+template<typename T>
+void ParameterSweep<T>::setThreads(unsigned int nThreads_) {
+    this->nThreads = nThreads_;
+}
+
+template<typename T>
+const std::vector<int>& ParameterSweep<T>::getNodeIds() const {
+    return nodeColumns.ids;
+}
+
+template<typename T>
+const std::vector<int>& ParameterSweep<T>::getEdgeIds() const {
+    return edgeColumns.ids;
+}
+
+template<typename T>
+SweepResult<T> ParameterSweep<T>::simulate(const SweepVariant<T>& variant) const {
+    SweepResult<T> result;
+    try {
+        arch::Network<T> runNetwork = network.clone();
+        sim::Simulation<T> simulation;
+        simulationFromJSON<T>(definition, &runNetwork, simulation);
+
+        // only the last state is kept in memory
+        simulation.getSimulationResults()->setRetainedStates(1);
+
+        for (auto& [pumpId, pressure] : variant.pressurePumps) {
+            if (!runNetwork.getPressurePumps().count(pumpId)) {
+                throw std::invalid_argument("Pressure pump " + std::to_string(pumpId) + " is not defined.");
+            }
+            runNetwork.getPressurePump(pumpId)->setPressure(pressure);
+        }
+        for (auto& [pumpId, flowRate] : variant.flowRatePumps) {
+            if (!runNetwork.getFlowRatePumps().count(pumpId)) {
+                throw std::invalid_argument("Flow rate pump " + std::to_string(pumpId) + " is not defined.");
+            }
+            runNetwork.getFlowRatePump(pumpId)->setFlowRate(flowRate);
+        }
+        for (auto& [injectionId, injectionTime] : variant.injectionTimes) {
+            if (simulation.getPlatform() == sim::Platform::BigDroplet) {
+                simulation.getDropletInjection(injectionId)->setInjectionTime(injectionTime);
+            } else if (simulation.getPlatform() == sim::Platform::Mixing) {
+                simulation.getMixtureInjection(injectionId)->setInjectionTime(injectionTime);
+            } else {
+                throw std::invalid_argument("Injection times can only be set for BigDroplet and Mixing simulations.");
+            }
+        }
+
+        simulation.simulate();
+
+        auto const& states = simulation.getSimulationResults()->getStates();
+        result.nStates = states.getAddedStates();
+        if (!states.empty()) {
+            auto state = states.back();
+            result.time = state->getTime();
+            for (const T* pressure : orderByColumns(state->getPressures(), nodeColumns)) {
+                result.pressures.push_back((pressure != nullptr) ? *pressure : std::numeric_limits<T>::quiet_NaN());
+            }
+            for (const T* flowRate : orderByColumns(state->getFlowRates(), edgeColumns)) {
+                result.flowRates.push_back((flowRate != nullptr) ? *flowRate : std::numeric_limits<T>::quiet_NaN());
+            }
+        }
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    return result;
+}
+
+template<typename T>
+std::vector<SweepResult<T>> ParameterSweep<T>::run(const std::vector<SweepVariant<T>>& variants) const {
+    std::vector<SweepResult<T>> results(variants.size());
+    unsigned int threads = (nThreads > 0) ? nThreads : std::max(1u, std::thread::hardware_concurrency());
+    sim::ThreadPool pool(std::min<std::size_t>(threads, std::max<std::size_t>(variants.size(), 1)));
+    pool.run(variants.size(), [&](int i) {
+        results[i] = simulate(variants[i]);
+    });
+    return results;
+}
+
+}   // namespace porting
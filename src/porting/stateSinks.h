@@ -0,0 +1,90 @@
+/**
+ * @file stateSinks.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../result/Results.h"
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Simulation;
+
+}   // namespace sim
+
+namespace porting {
+
+/**
+ * @brief Sink that appends each state as one line of JSON to a file (JSON Lines), in the format of the states written by resultToJSON.
+ */
+template<typename T>
+class JsonLinesSink final : public result::StateSink<T> {
+private:
+    std::ofstream file;                 ///< File to which the states are appended.
+    result::ColumnIndex nodeColumns;    ///< Columns of the nodes, which define the order of the nodes of each state.
+    result::ColumnIndex edgeColumns;    ///< Columns of the edges, which define the order of the channels of each state.
+
+public:
+    /**
+     * @brief Constructor of a JSON Lines sink.
+     * @param[in] file Location of the file, which is overwritten.
+     */
+    explicit JsonLinesSink(std::string file);
+
+    /**
+     * @brief Append a state as one line of JSON.
+     * @param[in] state The new state.
+     * @param[in] simulation Pointer to the simulation of the state.
+     */
+    void write(result::State<T>* state, sim::Simulation<T>* simulation) override;
+
+    /**
+     * @brief Write the buffered lines to the file.
+     */
+    void flush() override;
+};
+
+/**
+ * @brief Sink that appends the time, pressures and flow rates of each state as a row to a file in the binary result format
+ * (see binaryPorter.h), which can be read with BinaryResult. The columns are defined by the first state, and the number of
+ * states in the header is updated whenever the sink is flushed. If the simulation stops before the final flush, BinaryResult
+ * counts the states from the size of the file. Droplet and mixture positions are not written.
+ */
+template<typename T>
+class BinarySink final : public result::StateSink<T> {
+private:
+    std::ofstream file;                 ///< File to which the states are appended.
+    result::ColumnIndex nodeColumns;    ///< Columns of the nodes, defined by the first state.
+    result::ColumnIndex edgeColumns;    ///< Columns of the edges, defined by the first state.
+    std::vector<double> row;            ///< Row of the current state.
+    std::int64_t nStates = 0;           ///< Number of written states.
+
+public:
+    /**
+     * @brief Constructor of a binary sink.
+     * @param[in] file Location of the file, which is overwritten.
+     */
+    explicit BinarySink(std::string file);
+
+    /**
+     * @brief Append the time, pressures and flow rates of a state as a row.
+     * @param[in] state The new state, which must not contain nodes or edges that were not part of the first state.
+     * @param[in] simulation Pointer to the simulation of the state.
+     */
+    void write(result::State<T>* state, sim::Simulation<T>* simulation) override;
+
+    /**
+     * @brief Update the number of states in the header and write the buffered rows to the file.
+     */
+    void flush() override;
+};
+
+}   // namespace porting
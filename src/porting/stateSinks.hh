@@ -0,0 +1,55 @@
+#include "stateSinks.h"
+
+namespace porting {
+
+template<typename T>
+JsonLinesSink<T>::JsonLinesSink(std::string file_) : file(file_) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open the file " + file_ + " for the states.");
+    }
+}
+
+template<typename T>
+void JsonLinesSink<T>::write(result::State<T>* state, sim::Simulation<T>* simulation) {
+    // nodes and edges that appear in later states are appended to the columns
+    nodeColumns.add(state->getPressures());
+    edgeColumns.add(state->getFlowRates());
+    file << writeState(state, simulation, nodeColumns, edgeColumns).dump() << '\n';
+}
+
+template<typename T>
+void JsonLinesSink<T>::flush() {
+    file.flush();
+}
+
+template<typename T>
+BinarySink<T>::BinarySink(std::string file_) : file(file_, std::ios::binary) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open the file " + file_ + " for the states.");
+    }
+}
+
+template<typename T>
+void BinarySink<T>::write(result::State<T>* state, sim::Simulation<T>* /*simulation*/) {
+    if (nStates == 0) {
+        nodeColumns.add(state->getPressures());
+        edgeColumns.add(state->getFlowRates());
+        writeBinaryHeader(file, 0, nodeColumns, edgeColumns);
+    }
+    writeBinaryRow(file, state, nodeColumns, edgeColumns, row);
+    nStates++;
+}
+
+template<typename T>
+void BinarySink<T>::flush() {
+    if (nStates > 0) {
+        // the number of states follows the magic of the header
+        auto end = file.tellp();
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&nStates), sizeof(std::int64_t));
+        file.seekp(end);
+    }
+    file.flush();
+}
+
+}   // namespace porting
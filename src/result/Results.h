@@ -4,9 +4,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <fstream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -31,6 +38,12 @@ class DropletPosition;
 
 template<typename T>
 class Fluid;
+
+template<typename T>
+struct MixturePosition;
+
+template<typename T>
+class Simulation;
 }
 
 namespace result {
@@ -136,6 +149,350 @@ struct State {
     const void printState();
 };
 
+/**
+ * @brief Enum to specify how the states of a simulation result are stored.
+ */
+enum class StateStorage {
+    Full,           ///< Every state is stored completely.
+    Delta,          ///< Every keyframeInterval-th state is stored completely, the states in between only store the values that changed.
+    Columnar        ///< The pressures and flow rates of all states are stored in one matrix, with a row per state and a column per node or edge.
+};
+
+/**
+ * @brief Struct to assign a dense column to the ids of the nodes or edges, which is shared by all states of a columnar store.
+ * The column of an id is looked up directly, since the ids of a network are small non-negative integers.
+ */
+struct ColumnIndex {
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();   ///< Column of ids that have no column.
+
+    std::vector<int> ids;                               ///< Id of each column.
+    std::vector<std::size_t> columns;                   ///< Column of each id, indexed by the id, or npos.
+
+    /**
+     * @brief Add a column for each id that has no column yet. New columns are added in ascending order of the ids.
+     * @param[in] newIds The ids, which must not be negative and may contain duplicates.
+     * @returns Whether columns were added.
+     */
+    bool add(std::vector<int> newIds);
+
+    /**
+     * @brief Add a column for each id of the map that has no column yet. New columns are added in ascending order of the ids.
+     * @param[in] values Map whose keys are the ids.
+     * @returns Whether columns were added.
+     */
+    template<typename V>
+    bool add(const std::unordered_map<int, V>& values);
+
+    /**
+     * @brief Get the column of an id.
+     * @param[in] id The id.
+     * @returns Column of the id, or npos if the id has no column.
+     */
+    std::size_t find(int id) const;
+
+    /**
+     * @brief Get the number of columns.
+     * @returns Number of columns.
+     */
+    std::size_t size() const;
+};
+
+/**
+ * @brief Struct to contain the changes of a map of a state with respect to the same map of the previous state.
+ */
+template<typename V>
+struct MapDelta {
+    std::vector<std::pair<int, V>> values;      ///< Entries that were added or changed <key, value>.
+    std::vector<int> removed;                   ///< Keys of the entries that were removed.
+
+    /**
+     * @brief Store the changes between the map of the previous and the current state.
+     * @param[in] previous Map of the previous state.
+     * @param[in] current Map of the current state.
+     * @param[in] keyframe Store all entries of the current map, independent of the previous map.
+     */
+    void encode(const std::unordered_map<int, V>& previous, const std::unordered_map<int, V>& current, bool keyframe);
+
+    /**
+     * @brief Apply the changes to the map of the previous state.
+     * @param[in, out] map Map of the previous state, which becomes the map of the current state.
+     */
+    void apply(std::unordered_map<int, V>& map) const;
+
+    /**
+     * @brief Get the number of stored entries.
+     * @returns Number of changed and removed entries.
+     */
+    std::size_t size() const;
+};
+
+/**
+ * @brief Struct to contain a state as the changes with respect to the previous state, or completely for keyframes.
+ */
+template<typename T>
+struct StateDelta {
+    int id;                                                                 ///< Sequential id of the state.
+    T time;                                                                 ///< Simulation time of the state.
+    MapDelta<T> pressures;                                                  ///< Changed pressures of the nodes.
+    MapDelta<T> flowRates;                                                  ///< Changed flow rates of the edges.
+    MapDelta<std::string> vtkFiles;                                         ///< Changed vtk files of the modules.
+    MapDelta<sim::DropletPosition<T>> dropletPositions;                     ///< Changed droplet positions.
+    MapDelta<std::deque<sim::MixturePosition<T>>> mixturePositions;         ///< Changed mixture positions of the channels.
+    MapDelta<int> filledEdges;                                              ///< Changed mixtures that fill the edges.
+
+    /**
+     * @brief Get the number of stored entries.
+     * @returns Number of changed and removed entries of all maps.
+     */
+    std::size_t size() const;
+};
+
+/**
+ * @brief Class to store the states of a simulation result, either completely, delta-encoded or in columns.
+ * The stored states are accessed by their index, i.e., like a vector of pointers to states. Delta-encoded states are
+ * reconstructed on access from the previous keyframe, and iterating over the states reconstructs each state only once.
+ * Columnar storage keeps the pressures and flow rates in contiguous rows, such that the values of a node or edge over
+ * time are read with one scan.
+ */
+template<typename T>
+class StateStore {
+private:
+    StateStorage storage = StateStorage::Full;      ///< How the states are stored.
+    int keyframeInterval = 16;                      ///< Number of states between two keyframes for delta storage.
+    std::vector<std::shared_ptr<State<T>>> states;  ///< Completely stored states.
+    std::vector<StateDelta<T>> deltas;              ///< Delta-encoded states.
+    std::unique_ptr<State<T>> last;                 ///< Last delta-encoded state, the reference of the next delta.
+    ColumnIndex nodeColumns;                        ///< Columns of the nodes for columnar storage.
+    ColumnIndex edgeColumns;                        ///< Columns of the edges for columnar storage.
+    std::vector<T> pressures;                       ///< Pressures of all states for columnar storage, row-major. Missing values are NaN.
+    std::vector<T> flowRates;                       ///< Flow rates of all states for columnar storage, row-major. Missing values are NaN.
+    std::size_t retainedStates = 0;                 ///< Number of most recent states that are kept, all states are kept for 0.
+    std::size_t first = 0;                          ///< Position of the first retained state in the stored states.
+    std::size_t nAdded = 0;                         ///< Number of added states, including the discarded states.
+
+    /**
+     * @brief Apply the changes of a delta-encoded state to the previous state.
+     */
+    static void apply(const StateDelta<T>& delta, State<T>& state);
+
+    /**
+     * @brief Append the values of a state as a row to a matrix, and add columns for new ids.
+     * @param[in, out] index Columns of the matrix.
+     * @param[in, out] matrix Row-major matrix, whose rows are widened when columns are added.
+     * @param[in] nRows Number of rows of the matrix.
+     * @param[in] values Values of the state.
+     */
+    static void appendRow(ColumnIndex& index, std::vector<T>& matrix, std::size_t nRows, const std::unordered_map<int, T>& values);
+
+    /**
+     * @brief Get the number of stored states, including discarded states that were not yet removed.
+     */
+    std::size_t stored() const;
+
+    /**
+     * @brief Discard the states that exceed the number of retained states.
+     */
+    void discard();
+
+    /**
+     * @brief Get a column of a matrix, or the values of an id of all states, if the states are not stored in columns.
+     */
+    std::vector<T> getSeries(int id, const ColumnIndex& index, const std::vector<T>& matrix, std::unordered_map<int, T> State<T>::* values) const;
+
+public:
+    /**
+     * @brief Iterator over the states of the store, that reconstructs delta-encoded states incrementally.
+     */
+    class Iterator {
+    private:
+        const StateStore<T>* store;             ///< Store of the states.
+        std::size_t index;                      ///< Index of the current state.
+        std::shared_ptr<State<T>> state;        ///< The current state, reconstructed when it is accessed.
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::shared_ptr<State<T>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::shared_ptr<State<T>>*;
+        using reference = const std::shared_ptr<State<T>>&;
+
+        Iterator(const StateStore<T>* store, std::size_t index);
+
+        reference operator*();
+        pointer operator->();
+        Iterator& operator++();
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+    };
+
+    /**
+     * @brief Set how the states are stored. Can only be changed while no states are stored.
+     * @param[in] storage Storage of the states.
+     * @param[in] keyframeInterval Number of states between two keyframes for delta storage.
+     */
+    void setStorage(StateStorage storage, int keyframeInterval = 16);
+
+    /**
+     * @brief Get how the states are stored.
+     * @returns Storage of the states.
+     */
+    StateStorage getStorage() const;
+
+    /**
+     * @brief Get the number of states between two keyframes for delta storage.
+     * @returns Keyframe interval.
+     */
+    int getKeyframeInterval() const;
+
+    /**
+     * @brief Keep only the most recent states, older states are discarded. The id of a state remains its sequential id
+     * within the simulation, while the index of the first retained state is 0.
+     * @param[in] retainedStates Number of retained states, all states are kept for 0.
+     */
+    void setRetainedStates(std::size_t retainedStates);
+
+    /**
+     * @brief Get the number of most recent states that are kept.
+     * @returns Number of retained states, 0 if all states are kept.
+     */
+    std::size_t getRetainedStates() const;
+
+    /**
+     * @brief Add a state after the last stored state.
+     * @param[in] state The new state.
+     */
+    void add(std::unique_ptr<State<T>> state);
+
+    /**
+     * @brief Get a state. Delta-encoded and columnar states are reconstructed on every call, and only the returned pointer
+     * keeps the reconstructed state alive. Hence, the pointer has to be kept as long as references to the values of the
+     * state are used, e.g., `auto state = store.at(i); auto& flowRates = state->getFlowRates();` instead of
+     * `auto& flowRates = store.at(i)->getFlowRates();`, which dangles.
+     * @param[in] index Index of the state.
+     * @returns Pointer to the state. Changes to a delta-encoded or columnar state are not stored.
+     */
+    std::shared_ptr<State<T>> at(std::size_t index) const;
+
+    /**
+     * @brief Get a state. The returned pointer has to be kept as long as references to the values of the state are used (see at()).
+     * @param[in] index Index of the state.
+     * @returns Pointer to the state.
+     */
+    std::shared_ptr<State<T>> operator[](std::size_t index) const;
+
+    /**
+     * @brief Get the last state. The returned pointer has to be kept as long as references to the values of the state are used (see at()).
+     * @returns Pointer to the last state.
+     */
+    std::shared_ptr<State<T>> back() const;
+
+    /**
+     * @brief Get the number of stored states.
+     * @returns Number of states.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Get the number of states that were added, including the discarded states.
+     * @returns Number of added states.
+     */
+    std::size_t getAddedStates() const;
+
+    /**
+     * @brief Get the columns of all nodes and edges of the stored states, in ascending order of their ids. Writers use these
+     * columns to write the values of every state in the same order. The ids are read from the stored maps, deltas or columns,
+     * without reconstructing the states.
+     * @param[out] nodeColumns Columns of the nodes.
+     * @param[out] edgeColumns Columns of the edges.
+     */
+    void getColumns(ColumnIndex& nodeColumns, ColumnIndex& edgeColumns) const;
+
+    /**
+     * @brief Whether no states are stored.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the number of stored entries, i.e., pressures, flow rates, droplet and mixture positions, of all states.
+     * @returns Number of stored entries.
+     */
+    std::size_t getStoredEntries() const;
+
+    /**
+     * @brief Get the ids of the nodes in the order of the pressure columns. Only available for columnar storage.
+     * @returns Node id of each column.
+     */
+    const std::vector<int>& getNodeIds() const;
+
+    /**
+     * @brief Get the ids of the edges in the order of the flow rate columns. Only available for columnar storage.
+     * @returns Edge id of each column.
+     */
+    const std::vector<int>& getEdgeIds() const;
+
+    /**
+     * @brief Get the pressures of a state as a row with one value per node column. Only available for columnar storage.
+     * @param[in] index Index of the state.
+     * @returns Pointer to the first pressure of the row in Pa.
+     */
+    const T* getPressureRow(std::size_t index) const;
+
+    /**
+     * @brief Get the flow rates of a state as a row with one value per edge column. Only available for columnar storage.
+     * @param[in] index Index of the state.
+     * @returns Pointer to the first flow rate of the row in m^3/s.
+     */
+    const T* getFlowRateRow(std::size_t index) const;
+
+    /**
+     * @brief Get the pressure of a node in all states.
+     * @param[in] nodeId Id of the node.
+     * @returns Pressure of each state in Pa, NaN for states that do not contain the node.
+     */
+    std::vector<T> getPressureSeries(int nodeId) const;
+
+    /**
+     * @brief Get the flow rate of an edge in all states.
+     * @param[in] edgeId Id of the edge.
+     * @returns Flow rate of each state in m^3/s, NaN for states that do not contain the edge.
+     */
+    std::vector<T> getFlowRateSeries(int edgeId) const;
+
+    /**
+     * @brief Get the simulation time of all states.
+     * @returns Time of each state in s.
+     */
+    std::vector<T> getTimes() const;
+
+    Iterator begin() const;
+    Iterator end() const;
+};
+
+/**
+ * @brief Interface for sinks, to which the states of a simulation are written as soon as they are saved, e.g., to stream
+ * the states of long simulations to a file.
+ */
+template<typename T>
+class StateSink {
+public:
+    /**
+     * @brief Virtual destructor of a sink.
+     */
+    virtual ~StateSink() { }
+
+    /**
+     * @brief Write a state, before it is added to the simulation result.
+     * @param[in] state The new state.
+     * @param[in] simulation Pointer to the simulation of the state.
+     */
+    virtual void write(State<T>* state, sim::Simulation<T>* simulation) = 0;
+
+    /**
+     * @brief Write the buffered states to their destination.
+     */
+    virtual void flush() { }
+};
+
 /**
  * @brief Struct to contain the simulation result specified by a chip, an unordered map of fluids, an unordered map of droplets, an unordered map of injections, a vector of states, a continuous fluid id, the maximal adaptive time step and the id of a resistance model.
  */
@@ -147,7 +504,7 @@ struct SimulationResult {
     std::unordered_map<int, sim::Mixture<T>*> mixtures;
     std::unordered_map<int, sim::Specie<T>>* species;
     std::unordered_map<int, int> filledEdges;
-    std::vector<std::unique_ptr<State<T>>> states;                  /// Contains all states ordered according to their simulation time (beginning at the start of the simulation).    
+    StateStore<T> states;                                           /// Contains all states ordered according to their simulation time (beginning at the start of the simulation).
 
     int continuousPhaseId;              /// Fluid id which served as the continuous phase.
     T maximalAdaptiveTimeStep;     /// Value for the maximal adaptive time step that was used.
@@ -192,6 +549,25 @@ struct SimulationResult {
     */
     void addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions);
 
+    /**
+     * @brief Adds a state to the simulation results.
+     * @param[in] state The new state, whose id is the number of previously added states.
+    */
+    void addState(std::unique_ptr<State<T>> state);
+
+    /**
+     * @brief Update the mixtures that fill the edges with the mixture positions of a new state.
+     * @param[in] mixturePositions The positions of the mixtures at the current time step.
+     * @returns The mixtures that fill the edges <EdgeID, MixtureID>.
+    */
+    const std::unordered_map<int, int>& updateFilledEdges(const std::unordered_map<int, std::deque<sim::MixturePosition<T>>>& mixturePositions);
+
+    /**
+     * @brief Keep only the most recent states in memory, e.g., when all states are written to a sink.
+     * @param[in] retainedStates Number of retained states, all states are kept for 0.
+    */
+    void setRetainedStates(std::size_t retainedStates);
+
     /**
      * @brief Get the simulated flowrates in the channels.
      * @return Vector of flowrate values
@@ -200,9 +576,16 @@ struct SimulationResult {
 
     /**
      * @brief Get the simulated states that were stored during simulation.
-     * @return Vector of states
+     * @return Store of the states, which is accessed like a vector of pointers to states.
+     */
+    const StateStore<T>& getStates() const;
+
+    /**
+     * @brief Set how the states are stored. Can only be changed before the first state is stored.
+     * @param[in] storage Storage of the states.
+     * @param[in] keyframeInterval Number of states between two keyframes for delta storage.
      */
-    const std::vector<std::unique_ptr<State<T>>>& getStates() const;
+    void setStateStorage(StateStorage storage, int keyframeInterval = 16);
 
     /**
      * @brief Print all the states that were stored during simulation.
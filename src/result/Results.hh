@@ -103,6 +103,484 @@ const void State<T>::printState() {
     }
 }
 
+/**
+ * @brief Compare two values of a state map.
+ */
+template<typename V>
+bool isEqual(const V& a, const V& b) {
+    return a == b;
+}
+
+template<typename T>
+bool isEqual(const sim::DropletPosition<T>& a, const sim::DropletPosition<T>& b) {
+    if (a.channelIds != b.channelIds || a.boundaries.size() != b.boundaries.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.boundaries.size(); ++i) {
+        auto& boundaryA = a.boundaries[i];
+        auto& boundaryB = b.boundaries[i];
+        if (boundaryA.getChannelPosition().getChannel() != boundaryB.getChannelPosition().getChannel() ||
+            boundaryA.getChannelPosition().getPosition() != boundaryB.getChannelPosition().getPosition() ||
+            boundaryA.isVolumeTowardsNodeA() != boundaryB.isVolumeTowardsNodeA() || boundaryA.getState() != boundaryB.getState()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool isEqual(const std::deque<sim::MixturePosition<T>>& a, const std::deque<sim::MixturePosition<T>>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].mixtureId != b[i].mixtureId || a[i].channel != b[i].channel || a[i].position1 != b[i].position1 || a[i].position2 != b[i].position2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename V>
+void MapDelta<V>::encode(const std::unordered_map<int, V>& previous, const std::unordered_map<int, V>& current, bool keyframe) {
+    values.clear();
+    removed.clear();
+    for (auto& [key, value] : current) {
+        if (!keyframe) {
+            auto previousValue = previous.find(key);
+            if (previousValue != previous.end() && isEqual(previousValue->second, value)) {
+                continue;
+            }
+        }
+        values.emplace_back(key, value);
+    }
+    if (!keyframe) {
+        for (auto& [key, value] : previous) {
+            if (!current.count(key)) {
+                removed.push_back(key);
+            }
+        }
+    }
+}
+
+template<typename V>
+void MapDelta<V>::apply(std::unordered_map<int, V>& map) const {
+    for (int key : removed) {
+        map.erase(key);
+    }
+    for (auto& [key, value] : values) {
+        map.insert_or_assign(key, value);
+    }
+}
+
+template<typename V>
+std::size_t MapDelta<V>::size() const {
+    return values.size() + removed.size();
+}
+
+template<typename T>
+std::size_t StateDelta<T>::size() const {
+    return pressures.size() + flowRates.size() + vtkFiles.size() + dropletPositions.size() + mixturePositions.size() + filledEdges.size();
+}
+
+inline bool ColumnIndex::add(std::vector<int> newIds) {
+    std::sort(newIds.begin(), newIds.end());
+    newIds.erase(std::unique(newIds.begin(), newIds.end()), newIds.end());
+    bool added = false;
+    for (int id : newIds) {
+        if (id < 0) {
+            throw std::invalid_argument("Negative id " + std::to_string(id) + " cannot be assigned to a column.");
+        }
+        if (find(id) == npos) {
+            if (static_cast<std::size_t>(id) >= columns.size()) {
+                columns.resize(id + 1, npos);
+            }
+            columns[id] = ids.size();
+            ids.push_back(id);
+            added = true;
+        }
+    }
+    return added;
+}
+
+template<typename V>
+bool ColumnIndex::add(const std::unordered_map<int, V>& values) {
+    std::vector<int> newIds;
+    for (auto& [id, value] : values) {
+        if (find(id) == npos) {
+            newIds.push_back(id);
+        }
+    }
+    return !newIds.empty() && add(std::move(newIds));
+}
+
+inline std::size_t ColumnIndex::find(int id) const {
+    return (id >= 0 && static_cast<std::size_t>(id) < columns.size()) ? columns[id] : npos;
+}
+
+inline std::size_t ColumnIndex::size() const {
+    return ids.size();
+}
+
+template<typename T>
+StateStore<T>::Iterator::Iterator(const StateStore<T>* store_, std::size_t index_) : store(store_), index(index_) { }
+
+template<typename T>
+typename StateStore<T>::Iterator::reference StateStore<T>::Iterator::operator*() {
+    if (state == nullptr) {
+        state = store->at(index);
+    }
+    return state;
+}
+
+template<typename T>
+typename StateStore<T>::Iterator::pointer StateStore<T>::Iterator::operator->() {
+    return &operator*();
+}
+
+template<typename T>
+typename StateStore<T>::Iterator& StateStore<T>::Iterator::operator++() {
+    index++;
+    // the next delta-encoded state is reconstructed from the current state, unless it is a keyframe
+    std::size_t position = store->first + index;
+    if (state != nullptr && store->storage == StateStorage::Delta && index < store->size() && position % store->keyframeInterval != 0) {
+        auto next = std::make_shared<State<T>>(*state);
+        apply(store->deltas[position], *next);
+        state = std::move(next);
+    } else {
+        state = nullptr;
+    }
+    return *this;
+}
+
+template<typename T>
+bool StateStore<T>::Iterator::operator==(const Iterator& other) const {
+    return store == other.store && index == other.index;
+}
+
+template<typename T>
+bool StateStore<T>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template<typename T>
+void StateStore<T>::apply(const StateDelta<T>& delta, State<T>& state) {
+    state.id = delta.id;
+    state.time = delta.time;
+    delta.pressures.apply(state.pressures);
+    delta.flowRates.apply(state.flowRates);
+    delta.vtkFiles.apply(state.vtkFiles);
+    delta.dropletPositions.apply(state.dropletPositions);
+    delta.mixturePositions.apply(state.mixturePositions);
+    delta.filledEdges.apply(state.filledEdges);
+}
+
+template<typename T>
+void StateStore<T>::appendRow(ColumnIndex& index, std::vector<T>& matrix, std::size_t nRows, const std::unordered_map<int, T>& values) {
+    const T missing = std::numeric_limits<T>::quiet_NaN();
+    std::size_t width = index.size();
+    if (index.add(values) && nRows > 0) {
+        // widen the rows of the previous states for the new columns
+        std::vector<T> widened(nRows * index.size(), missing);
+        for (std::size_t row = 0; row < nRows; ++row) {
+            std::copy(matrix.begin() + row * width, matrix.begin() + (row + 1) * width, widened.begin() + row * index.size());
+        }
+        matrix = std::move(widened);
+    }
+    matrix.resize((nRows + 1) * index.size(), missing);
+    T* row = matrix.data() + nRows * index.size();
+    for (auto& [id, value] : values) {
+        row[index.find(id)] = value;
+    }
+}
+
+template<typename T>
+std::size_t StateStore<T>::stored() const {
+    return (storage == StateStorage::Delta) ? deltas.size() : states.size();
+}
+
+template<typename T>
+void StateStore<T>::discard() {
+    if (retainedStates == 0 || size() <= retainedStates) {
+        return;
+    }
+    first = stored() - retainedStates;
+
+    // discarded states are removed in blocks, such that removing them is amortized over the added states
+    if (first < std::max<std::size_t>(retainedStates, keyframeInterval)) {
+        return;
+    }
+    if (storage == StateStorage::Delta) {
+        // keep the keyframe of the first retained state
+        std::size_t n = first - first % keyframeInterval;
+        deltas.erase(deltas.begin(), deltas.begin() + n);
+        first -= n;
+        return;
+    }
+    states.erase(states.begin(), states.begin() + first);
+    pressures.erase(pressures.begin(), pressures.begin() + first * nodeColumns.size());
+    flowRates.erase(flowRates.begin(), flowRates.begin() + first * edgeColumns.size());
+    first = 0;
+}
+
+template<typename T>
+std::vector<T> StateStore<T>::getSeries(int id, const ColumnIndex& index, const std::vector<T>& matrix, std::unordered_map<int, T> State<T>::* values) const {
+    std::vector<T> series;
+    series.reserve(size());
+    if (storage == StateStorage::Columnar) {
+        std::size_t column = index.find(id);
+        for (std::size_t row = first; row < stored(); ++row) {
+            series.push_back((column != ColumnIndex::npos) ? matrix[row * index.size() + column] : std::numeric_limits<T>::quiet_NaN());
+        }
+        return series;
+    }
+    for (auto& state : *this) {
+        auto value = ((*state).*values).find(id);
+        series.push_back((value != ((*state).*values).end()) ? value->second : std::numeric_limits<T>::quiet_NaN());
+    }
+    return series;
+}
+
+template<typename T>
+void StateStore<T>::setStorage(StateStorage storage_, int keyframeInterval_) {
+    if (nAdded > 0) {
+        throw std::invalid_argument("The state storage can only be changed before states are stored.");
+    }
+    if (keyframeInterval_ < 1) {
+        throw std::invalid_argument("The keyframe interval must be at least 1.");
+    }
+    storage = storage_;
+    keyframeInterval = keyframeInterval_;
+}
+
+template<typename T>
+StateStorage StateStore<T>::getStorage() const {
+    return storage;
+}
+
+template<typename T>
+int StateStore<T>::getKeyframeInterval() const {
+    return keyframeInterval;
+}
+
+template<typename T>
+void StateStore<T>::setRetainedStates(std::size_t retainedStates_) {
+    retainedStates = retainedStates_;
+    discard();
+}
+
+template<typename T>
+std::size_t StateStore<T>::getRetainedStates() const {
+    return retainedStates;
+}
+
+template<typename T>
+void StateStore<T>::add(std::unique_ptr<State<T>> state) {
+    nAdded++;
+    if (storage == StateStorage::Full) {
+        states.push_back(std::move(state));
+    } else if (storage == StateStorage::Columnar) {
+        appendRow(nodeColumns, pressures, states.size(), state->pressures);
+        appendRow(edgeColumns, flowRates, states.size(), state->flowRates);
+        std::unordered_map<int, T>().swap(state->pressures);
+        std::unordered_map<int, T>().swap(state->flowRates);
+        states.push_back(std::move(state));
+    } else {
+        const bool keyframe = deltas.size() % keyframeInterval == 0;
+        const State<T> empty(state->id, state->time);
+        const State<T>& previous = keyframe ? empty : *last;
+        StateDelta<T>& delta = deltas.emplace_back();
+        delta.id = state->id;
+        delta.time = state->time;
+        delta.pressures.encode(previous.pressures, state->pressures, keyframe);
+        delta.flowRates.encode(previous.flowRates, state->flowRates, keyframe);
+        delta.vtkFiles.encode(previous.vtkFiles, state->vtkFiles, keyframe);
+        delta.dropletPositions.encode(previous.dropletPositions, state->dropletPositions, keyframe);
+        delta.mixturePositions.encode(previous.mixturePositions, state->mixturePositions, keyframe);
+        delta.filledEdges.encode(previous.filledEdges, state->filledEdges, keyframe);
+        last = std::move(state);
+    }
+    discard();
+}
+
+template<typename T>
+std::shared_ptr<State<T>> StateStore<T>::at(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("State " + std::to_string(index) + " does not exist.");
+    }
+    std::size_t position = first + index;
+    if (storage == StateStorage::Full) {
+        return states[position];
+    }
+    if (storage == StateStorage::Columnar) {
+        // the remaining values of the state are complemented by its rows
+        auto state = std::make_shared<State<T>>(*states[position]);
+        const T* pressureRow = getPressureRow(index);
+        const T* flowRateRow = getFlowRateRow(index);
+        for (std::size_t column = 0; column < nodeColumns.size(); ++column) {
+            if (!std::isnan(pressureRow[column])) {
+                state->pressures.try_emplace(nodeColumns.ids[column], pressureRow[column]);
+            }
+        }
+        for (std::size_t column = 0; column < edgeColumns.size(); ++column) {
+            if (!std::isnan(flowRateRow[column])) {
+                state->flowRates.try_emplace(edgeColumns.ids[column], flowRateRow[column]);
+            }
+        }
+        return state;
+    }
+
+    // reconstruct the state from the previous keyframe
+    std::size_t keyframe = position - position % keyframeInterval;
+    auto state = std::make_shared<State<T>>(deltas[keyframe].id, deltas[keyframe].time);
+    for (std::size_t i = keyframe; i <= position; ++i) {
+        apply(deltas[i], *state);
+    }
+    return state;
+}
+
+template<typename T>
+std::shared_ptr<State<T>> StateStore<T>::operator[](std::size_t index) const {
+    return at(index);
+}
+
+template<typename T>
+std::shared_ptr<State<T>> StateStore<T>::back() const {
+    return at(size() - 1);
+}
+
+template<typename T>
+std::size_t StateStore<T>::size() const {
+    return stored() - first;
+}
+
+template<typename T>
+std::size_t StateStore<T>::getAddedStates() const {
+    return nAdded;
+}
+
+template<typename T>
+void StateStore<T>::getColumns(ColumnIndex& nodeColumns_, ColumnIndex& edgeColumns_) const {
+    // the ids of all states are collected first, such that the columns are sorted over all states
+    ColumnIndex nodes;
+    ColumnIndex edges;
+    if (storage == StateStorage::Columnar) {
+        // the columns of the store already contain the ids of all states
+        nodes = nodeColumns;
+        edges = edgeColumns;
+    } else if (storage == StateStorage::Delta) {
+        // the ids are read from the deltas, from the keyframe of the first state on, without reconstructing the states
+        auto addIds = [](ColumnIndex& index, const MapDelta<T>& delta) {
+            std::vector<int> newIds;
+            for (auto& [id, value] : delta.values) {
+                if (index.find(id) == ColumnIndex::npos) {
+                    newIds.push_back(id);
+                }
+            }
+            index.add(std::move(newIds));
+        };
+        for (std::size_t position = first - first % keyframeInterval; position < deltas.size(); ++position) {
+            addIds(nodes, deltas[position].pressures);
+            addIds(edges, deltas[position].flowRates);
+        }
+    } else {
+        for (std::size_t position = first; position < states.size(); ++position) {
+            nodes.add(states[position]->pressures);
+            edges.add(states[position]->flowRates);
+        }
+    }
+    nodeColumns_ = ColumnIndex();
+    edgeColumns_ = ColumnIndex();
+    nodeColumns_.add(std::move(nodes.ids));
+    edgeColumns_.add(std::move(edges.ids));
+}
+
+template<typename T>
+bool StateStore<T>::empty() const {
+    return size() == 0;
+}
+
+template<typename T>
+std::size_t StateStore<T>::getStoredEntries() const {
+    std::size_t entries = 0;
+    for (auto& state : states) {
+        entries += state->pressures.size() + state->flowRates.size() + state->vtkFiles.size() + state->dropletPositions.size() +
+                   state->mixturePositions.size() + state->filledEdges.size();
+    }
+    for (auto& delta : deltas) {
+        entries += delta.size();
+    }
+    return entries + pressures.size() + flowRates.size();
+}
+
+template<typename T>
+const std::vector<int>& StateStore<T>::getNodeIds() const {
+    if (storage != StateStorage::Columnar) {
+        throw std::invalid_argument("The states are not stored in columns.");
+    }
+    return nodeColumns.ids;
+}
+
+template<typename T>
+const std::vector<int>& StateStore<T>::getEdgeIds() const {
+    if (storage != StateStorage::Columnar) {
+        throw std::invalid_argument("The states are not stored in columns.");
+    }
+    return edgeColumns.ids;
+}
+
+template<typename T>
+const T* StateStore<T>::getPressureRow(std::size_t index) const {
+    if (storage != StateStorage::Columnar) {
+        throw std::invalid_argument("The states are not stored in columns.");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("State " + std::to_string(index) + " does not exist.");
+    }
+    return pressures.data() + (first + index) * nodeColumns.size();
+}
+
+template<typename T>
+const T* StateStore<T>::getFlowRateRow(std::size_t index) const {
+    if (storage != StateStorage::Columnar) {
+        throw std::invalid_argument("The states are not stored in columns.");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("State " + std::to_string(index) + " does not exist.");
+    }
+    return flowRates.data() + (first + index) * edgeColumns.size();
+}
+
+template<typename T>
+std::vector<T> StateStore<T>::getPressureSeries(int nodeId) const {
+    return getSeries(nodeId, nodeColumns, pressures, &State<T>::pressures);
+}
+
+template<typename T>
+std::vector<T> StateStore<T>::getFlowRateSeries(int edgeId) const {
+    return getSeries(edgeId, edgeColumns, flowRates, &State<T>::flowRates);
+}
+
+template<typename T>
+std::vector<T> StateStore<T>::getTimes() const {
+    std::vector<T> times;
+    times.reserve(size());
+    for (std::size_t position = first; position < stored(); ++position) {
+        times.push_back((storage == StateStorage::Delta) ? deltas[position].time : states[position]->time);
+    }
+    return times;
+}
+
+template<typename T>
+typename StateStore<T>::Iterator StateStore<T>::begin() const {
+    return Iterator(this, 0);
+}
+
+template<typename T>
+typename StateStore<T>::Iterator StateStore<T>::end() const {
+    return Iterator(this, size());
+}
+
 template<typename T>
 SimulationResult<T>::SimulationResult() { }
 
@@ -114,28 +592,32 @@ SimulationResult<T>::SimulationResult(  arch::Network<T>* network_,
 
 template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates) {
-    int id = states.size();
-    std::unique_ptr<State<T>> newState = std::make_unique<State<T>>(id, time, pressures, flowRates);
-    states.push_back(std::move(newState));
+    addState(std::make_unique<State<T>>(states.getAddedStates(), time, pressures, flowRates));
 }
 
 template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::string> vtkFiles) {
-    int id = states.size();
-    std::unique_ptr<State<T>> newState = std::make_unique<State<T>>(id, time, pressures, flowRates, vtkFiles);
-    states.push_back(std::move(newState));
+    addState(std::make_unique<State<T>>(states.getAddedStates(), time, pressures, flowRates, vtkFiles));
 }
 
 template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, sim::DropletPosition<T>> dropletPositions) {
-    int id = states.size();
-    std::unique_ptr<State<T>> newState = std::make_unique<State<T>>(id, time, pressures, flowRates, dropletPositions);
-    states.push_back(std::move(newState));
+    addState(std::make_unique<State<T>>(states.getAddedStates(), time, pressures, flowRates, dropletPositions));
 }
 
 template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions) {
-    int id = states.size();
+    updateFilledEdges(mixturePositions);
+    addState(std::make_unique<State<T>>(states.getAddedStates(), time, pressures, flowRates, mixturePositions, filledEdges));
+}
+
+template<typename T>
+void SimulationResult<T>::addState(std::unique_ptr<State<T>> state) {
+    states.add(std::move(state));
+}
+
+template<typename T>
+const std::unordered_map<int, int>& SimulationResult<T>::updateFilledEdges(const std::unordered_map<int, std::deque<sim::MixturePosition<T>>>& mixturePositions) {
     for ( auto& [channelId, deque] : mixturePositions ) {
         if (filledEdges.count(channelId)) {
             filledEdges.at(channelId) = deque.front().mixtureId;
@@ -143,15 +625,24 @@ void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures,
             filledEdges.try_emplace(channelId, deque.back().mixtureId);
         }
     }
-    std::unique_ptr<State<T>> newState = std::make_unique<State<T>>(id, time, pressures, flowRates, mixturePositions, filledEdges);
-    states.push_back(std::move(newState));
+    return filledEdges;
 }
 
 template<typename T>
-const std::vector<std::unique_ptr<State<T>>>& SimulationResult<T>::getStates() const {
+void SimulationResult<T>::setRetainedStates(std::size_t retainedStates) {
+    states.setRetainedStates(retainedStates);
+}
+
+template<typename T>
+const StateStore<T>& SimulationResult<T>::getStates() const {
     return states;
 }
 
+template<typename T>
+void SimulationResult<T>::setStateStorage(StateStorage storage, int keyframeInterval) {
+    states.setStorage(storage, keyframeInterval);
+}
+
 template<typename T>
 const void SimulationResult<T>::printStates() const {
     for ( auto& state : states ) {
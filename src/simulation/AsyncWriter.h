@@ -0,0 +1,125 @@
+/**
+ * @file AsyncWriter.h
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+/**
+ * @brief Class to define a background thread that executes output tasks, e.g., the serialization of vtk snapshots, in submission order.
+ * The number of tasks in flight is bounded, such that a slow file system throttles the submitting thread instead of exhausting the memory.
+ */
+class AsyncWriter {
+private:
+    std::thread worker;                             ///< Background thread that executes the tasks.
+    std::mutex mutex;                               ///< Protects the queue of tasks.
+    std::condition_variable taskAvailable;          ///< Signals the worker that a task was submitted.
+    std::condition_variable taskFinished;           ///< Signals the submitting thread that a task is finished.
+    std::deque<std::function<void()>> tasks;        ///< Queue of submitted tasks that are not yet started.
+    std::size_t maxQueued;                          ///< Maximal number of tasks in flight.
+    std::size_t inFlight = 0;                       ///< Number of submitted tasks that are not yet finished.
+    bool stopping = false;                          ///< Is the writer being destroyed?
+    std::exception_ptr exception;                   ///< First exception thrown by a task.
+
+    /**
+     * @brief Loop of the background thread, that executes the queued tasks until the writer is destroyed.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Rethrow the first exception thrown by a task, if any. Requires a lock on the mutex.
+     */
+    void rethrow();
+
+public:
+    /**
+     * @brief Constructor of the asynchronous writer.
+     * @param[in] maxQueued Maximal number of tasks in flight, i.e., queued or being executed. Must be positive.
+     */
+    explicit AsyncWriter(std::size_t maxQueued);
+
+    /**
+     * @brief Destructor of the asynchronous writer, that executes all remaining tasks and joins the background thread.
+     */
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    /**
+     * @brief Submit a task to the background thread. Blocks while the maximal number of tasks is in flight.
+     * The first exception thrown by a previous task is rethrown.
+     * @param[in] task Task that is executed on the background thread.
+     */
+    void push(std::function<void()> task);
+
+    /**
+     * @brief Wait until all submitted tasks are finished. The first exception thrown by a task is rethrown.
+     */
+    void flush();
+
+    /**
+     * @brief Get the maximal number of tasks in flight.
+     * @returns Maximal number of tasks in flight.
+     */
+    std::size_t getMaxQueued() const;
+};
+
+/**
+ * @brief Class to define a small pool of reusable buffers, e.g., the snapshots that are handed to an asynchronous writer.
+ * A buffer returns to the pool when it is no longer used, such that the next write reuses its memory instead of allocating
+ * a new buffer. Buffers may be acquired and released on different threads and may outlive the pool.
+ */
+template<typename Buffer>
+class BufferPool {
+private:
+    /**
+     * @brief State of the pool that is shared with the acquired buffers, such that they can be released after the pool is destroyed.
+     */
+    struct Shared {
+        std::mutex mutex;                               ///< Protects the released buffers.
+        std::vector<std::unique_ptr<Buffer>> released;  ///< Released buffers that can be reused.
+        std::size_t maxReleased;                        ///< Maximal number of released buffers that are kept.
+        std::size_t nCreated = 0;                       ///< Number of buffers that were created.
+    };
+
+    std::shared_ptr<Shared> shared;                 ///< State of the pool.
+
+public:
+    /**
+     * @brief Constructor of the buffer pool.
+     * @param[in] maxReleased Maximal number of released buffers that are kept for reuse, further buffers are destroyed on release.
+     */
+    explicit BufferPool(std::size_t maxReleased);
+
+    /**
+     * @brief Acquire a buffer. A released buffer keeps its previous content, new buffers are default constructed.
+     * @returns Pointer to the buffer, which returns the buffer to the pool when the last copy is destroyed.
+     */
+    std::shared_ptr<Buffer> acquire();
+
+    /**
+     * @brief Get the number of buffers that were created, i.e., that were not reused.
+     * @returns Number of created buffers.
+     */
+    std::size_t getCreatedBuffers() const;
+
+    /**
+     * @brief Get the number of released buffers that are kept for reuse.
+     * @returns Number of released buffers.
+     */
+    std::size_t getReleasedBuffers() const;
+};
+
+}   // namespace sim
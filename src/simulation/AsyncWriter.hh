@@ -0,0 +1,125 @@
+#include "AsyncWriter.h"
+
+namespace sim {
+
+inline AsyncWriter::AsyncWriter(std::size_t maxQueued_) : maxQueued(maxQueued_) {
+    if (maxQueued == 0) {
+        throw std::invalid_argument("The asynchronous writer requires a positive number of tasks in flight.");
+    }
+    worker = std::thread(&AsyncWriter::workerLoop, this);
+}
+
+inline AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    worker.join();
+}
+
+inline void AsyncWriter::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        taskAvailable.wait(lock, [&]() { return stopping || !tasks.empty(); });
+        // remaining tasks are executed before the writer stops
+        if (tasks.empty()) {
+            return;
+        }
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        std::exception_ptr taskException;
+        try {
+            task();
+        } catch (...) {
+            taskException = std::current_exception();
+        }
+        // release the resources of the task, e.g., its buffers, before the submitting thread is notified
+        task = nullptr;
+        lock.lock();
+        if (taskException && !exception) {
+            exception = taskException;
+        }
+        inFlight--;
+        taskFinished.notify_all();
+    }
+}
+
+inline void AsyncWriter::rethrow() {
+    if (exception) {
+        std::exception_ptr taskException = exception;
+        exception = nullptr;
+        std::rethrow_exception(taskException);
+    }
+}
+
+inline void AsyncWriter::push(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(mutex);
+    taskFinished.wait(lock, [&]() { return inFlight < maxQueued; });
+    rethrow();
+    tasks.push_back(std::move(task));
+    inFlight++;
+    taskAvailable.notify_one();
+}
+
+inline void AsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    taskFinished.wait(lock, [&]() { return inFlight == 0; });
+    rethrow();
+}
+
+inline std::size_t AsyncWriter::getMaxQueued() const {
+    return maxQueued;
+}
+
+template<typename Buffer>
+BufferPool<Buffer>::BufferPool(std::size_t maxReleased_) : shared(std::make_shared<Shared>()) {
+    shared->maxReleased = maxReleased_;
+}
+
+template<typename Buffer>
+std::shared_ptr<Buffer> BufferPool<Buffer>::acquire() {
+    std::unique_ptr<Buffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        if (!shared->released.empty()) {
+            buffer = std::move(shared->released.back());
+            shared->released.pop_back();
+        } else {
+            shared->nCreated++;
+        }
+    }
+    if (buffer == nullptr) {
+        buffer = std::make_unique<Buffer>();
+    }
+
+    // the deleter keeps the state of the pool alive, such that the buffer can be released after the pool is destroyed
+    std::shared_ptr<Shared> state = shared;
+    return std::shared_ptr<Buffer>(buffer.release(), [state](Buffer* released) {
+        std::unique_ptr<Buffer> owned(released);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->released.size() < state->maxReleased) {
+                state->released.push_back(std::move(owned));
+                return;
+            }
+        }
+        // surplus buffers are destroyed outside of the lock
+        owned.reset();
+    });
+}
+
+template<typename Buffer>
+std::size_t BufferPool<Buffer>::getCreatedBuffers() const {
+    std::lock_guard<std::mutex> lock(shared->mutex);
+    return shared->nCreated;
+}
+
+template<typename Buffer>
+std::size_t BufferPool<Buffer>::getReleasedBuffers() const {
+    std::lock_guard<std::mutex> lock(shared->mutex);
+    return shared->released.size();
+}
+
+}   // namespace sim
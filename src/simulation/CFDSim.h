@@ -5,34 +5,66 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace sim {
 
 // Forward declared dependencies
 template<typename T>
 class CFDSimulator;
+class ThreadPool;
+
+/**
+ * @brief Mutex that serializes the access of concurrently solved CFD simulators to the OpenLB singletons,
+ * i.e., the output directories and the VTK writers.
+ * @returns Reference to the mutex.
+ */
+inline std::mutex& getOlbSingletonMutex();
 
 /**
  * @brief Conduct the NS simulation step (of theta iterations) for all CFD simulators on the simulation. 
  * The amount of collide and stream iterations, theta, is obtained from the update scheme of the simulator.
+ * @param[in] cfdSimulators The CFD simulators of the simulation.
+ * @param[in] threadPool If given, the simulators are solved concurrently on the pool. Returns once all simulators are done.
  * @returns A boolean for whether all simulators have converged, or not.
  */
 template<typename T>
-bool conductCFDSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators);
+bool conductCFDSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool=nullptr);
 
 /**
  * @brief Conduct the coupling step between the AD lattice and the NS lattice for all simulators.
+ * @param[in] cfdSimulators The CFD simulators of the simulation.
+ * @param[in] threadPool If given, the simulators are coupled concurrently on the pool. Returns once all simulators are done.
  */
 template<typename T>
-void coupleNsAdLattices(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators);
+void coupleNsAdLattices(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool=nullptr);
 
 /**
  * @brief Conduct the AD simulation step (of theta iterations) for all CFD simulators on the simulation. 
  * The amount of collide and stream iterations, theta, is obtained from the update scheme of the simulator.
+ * @param[in] cfdSimulators The CFD simulators of the simulation.
+ * @param[in] threadPool If given, the simulators are solved concurrently on the pool. Returns once all simulators are done.
  * @returns A boolean for whether all simulators have converged, or not.
  */
 template<typename T>
-bool conductADSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators);
+bool conductADSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool=nullptr);
+
+/**
+ * @brief Wait until the vtk output that the CFD simulators write in the background is on the file system.
+ * @param[in] cfdSimulators The CFD simulators of the simulation.
+ */
+template<typename T>
+void flushVtkOutput(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators);
+
+/**
+ * @brief Apply a function to all CFD simulators, concurrently if a thread pool is given.
+ * @param[in] cfdSimulators The CFD simulators of the simulation.
+ * @param[in] threadPool Thread pool that executes the function, or nullptr for sequential execution.
+ * @param[in] function Function that is called for each simulator.
+ */
+template<typename T, typename F>
+void forEachCFDSimulator(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool, const F& function);
 
 }   // namespace sim
\ No newline at end of file
@@ -2,74 +2,106 @@
 
 namespace sim {
 
+    inline std::mutex& getOlbSingletonMutex() {
+        static std::mutex olbSingletonMutex;
+        return olbSingletonMutex;
+    }
+
+    template<typename T, typename F>
+    void forEachCFDSimulator(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool, const F& function) {
+        
+        if (threadPool == nullptr || threadPool->getThreads() <= 1 || cfdSimulators.size() <= 1) {
+            for (const auto& cfdSimulator : cfdSimulators) {
+                function(cfdSimulator.second.get());
+            }
+            return;
+        }
+
+        // The modules only exchange data through the nodal analysis, hence they can be solved concurrently
+        std::vector<CFDSimulator<T>*> simulators;
+        simulators.reserve(cfdSimulators.size());
+        for (const auto& cfdSimulator : cfdSimulators) {
+            simulators.push_back(cfdSimulator.second.get());
+        }
+        threadPool->run(simulators.size(), [&](int i) { function(simulators[i]); });
+    }
+
     template<typename T>
-    bool conductCFDSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators) {
+    bool conductCFDSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool) {
 
         bool allConverge = true;
 
         // loop through modules and perform the collide and stream operations
-        for (const auto& cfdSimulator : cfdSimulators) {
+        forEachCFDSimulator(cfdSimulators, threadPool, [](CFDSimulator<T>* cfdSimulator) {
             
             // Assertion that the current module is of lbm type, and can conduct CFD simulations.
             #ifndef USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::LBM);
             #elif USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
             #endif
-            cfdSimulator.second->solve();
+            cfdSimulator->solve();
+        });
 
+        for (const auto& cfdSimulator : cfdSimulators) {
             if (!cfdSimulator.second->hasConverged()) {
                 allConverge = false;
             }
-            
         }
 
         return allConverge;
     }
 
     template<typename T>
-    void coupleNsAdLattices(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators) {
+    void coupleNsAdLattices(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool) {
         
         // loop through modules and perform the coupling between the NS and AD lattices
-        for (const auto& cfdSimulator : cfdSimulators) {
+        forEachCFDSimulator(cfdSimulators, threadPool, [](CFDSimulator<T>* cfdSimulator) {
             
             // Assertion that the current module is of lbm type, and can conduct CFD simulations.
             #ifndef USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::LBM);
             #elif USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
             throw std::runtime_error("Coupling between NS and AD fields not defined for ESS LBM.");
             #endif
 
-            cfdSimulator.second->executeCoupling();
-            
-        }
+            cfdSimulator->executeCoupling();
+        });
     }
 
     template<typename T>
-    bool conductADSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators) {
+    bool conductADSimulation(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool) {
 
         bool allConverge = true;
 
         // loop through modules and perform the collide and stream operations
-        for (const auto& cfdSimulator : cfdSimulators) {
+        forEachCFDSimulator(cfdSimulators, threadPool, [](CFDSimulator<T>* cfdSimulator) {
             
             // Assertion that the current module is of lbm type, and can conduct CFD simulations.
             #ifndef USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::LBM);
             #elif USE_ESSLBM
-            assert(cfdSimulator.second->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
+            assert(cfdSimulator->getModule()->getModuleType() == arch::ModuleType::ESS_LBM);
             throw std::runtime_error("Simulation of Advection Diffusion not defined for ESS LBM.");
             #endif
-            cfdSimulator.second->adSolve();
+            cfdSimulator->adSolve();
+        });
 
+        for (const auto& cfdSimulator : cfdSimulators) {
             if (!cfdSimulator.second->hasAdConverged()) {
                 allConverge = false;
             }
-            
         }
 
         return allConverge;
     }
 
+    template<typename T>
+    void flushVtkOutput(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators) {
+        for (const auto& cfdSimulator : cfdSimulators) {
+            cfdSimulator.second->flushVTK();
+        }
+    }
+
 }   // namespace sim
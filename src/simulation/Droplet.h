@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "MemoryPool.h"
+
 namespace arch {
   
 // Forward declared dependencies
@@ -81,6 +83,12 @@ class DropletBoundary {
      */
     arch::ChannelPosition<T>& getChannelPosition();
 
+    /**
+     * @brief Get the channel position of the boundary.
+     * @return The channel position.
+     */
+    const arch::ChannelPosition<T>& getChannelPosition() const;
+
     /**
      * @brief Get the flow rate of the boundary.
      * @return The flow rate of the boundary.
@@ -212,7 +220,8 @@ class Droplet {
     Fluid<T>* fluid;                                      ///< Pointer to fluid of which the droplet consists of.
     std::vector<Droplet<T>*> mergedDroplets;              ///< List of previous droplets, if this droplet got merged.
     DropletState dropletState = DropletState::INJECTION;  ///< Current state of the droplet
-    std::vector<std::unique_ptr<DropletBoundary<T>>> boundaries;
+    std::shared_ptr<MemoryPool> pool;                     ///< Pool in which the boundaries are allocated, if any.
+    std::vector<PoolPtr<DropletBoundary<T>>> boundaries;  ///< Boundaries of the droplet.
     std::vector<arch::RectangularChannel<T>*> channels;              ///< Contains the channels, that are completely occupied by the droplet (can happen in short channels or with large droplets).
 
   public:
@@ -221,8 +230,9 @@ class Droplet {
      * @param[in] id Unique identifier of the droplet.
      * @param[in] volume Volume of the droplet in m^3.
      * @param[in] fluid Pointer to fluid the droplet consists of.
+     * @param[in] pool Pool in which the boundaries of the droplet are allocated. Without a pool, they are allocated on the heap.
      */
-    Droplet(int id, T volume, Fluid<T>* fluid);
+    Droplet(int id, T volume, Fluid<T>* fluid, std::shared_ptr<MemoryPool> pool = nullptr);
 
     /**
      * @brief Change volume of droplet.
@@ -282,7 +292,7 @@ class Droplet {
      * @brief Get the Boundaries object
      * @return all boundaries
      */
-    const std::vector<std::unique_ptr<DropletBoundary<T>>>& getBoundaries();
+    const std::vector<PoolPtr<DropletBoundary<T>>>& getBoundaries();
 
     /**
      * @brief Get all fully occupied channels
@@ -8,8 +8,8 @@ DropletPosition<T>::DropletPosition() { }
 ///-----------------------------Droplet------------------------------------///
 
 template<typename T>
-Droplet<T>::Droplet(int id, T volume, Fluid<T>* fluid) : 
-    id(id), volume(volume), fluid(fluid) { }
+Droplet<T>::Droplet(int id, T volume, Fluid<T>* fluid, std::shared_ptr<MemoryPool> pool) : 
+    id(id), volume(volume), fluid(fluid), pool(std::move(pool)) { }
 
 template<typename T>
 void Droplet<T>::setVolume(T volume) {
@@ -74,7 +74,7 @@ void Droplet<T>::addDropletResistance(const ResistanceModel<T>& model) {
 }
 
 template<typename T>
-const std::vector<std::unique_ptr<DropletBoundary<T>>>& Droplet<T>::getBoundaries() {
+const std::vector<PoolPtr<DropletBoundary<T>>>& Droplet<T>::getBoundaries() {
     return boundaries;
 }
 
@@ -98,7 +98,7 @@ bool Droplet<T>::isInsideSingleChannel() {
 
 template<typename T>
 void Droplet<T>::addBoundary(arch::RectangularChannel<T>* channel, T position, bool volumeTowardsNodeA, BoundaryState state) { 
-    boundaries.push_back(std::make_unique<DropletBoundary<T>>(channel, position, volumeTowardsNodeA, state));
+    boundaries.push_back(makePooled<DropletBoundary<T>, DropletBoundary<T>>(pool.get(), channel, position, volumeTowardsNodeA, state));
 }
 
 template<typename T>
@@ -264,6 +264,11 @@ arch::ChannelPosition<T>& DropletBoundary<T>::getChannelPosition() {
     return channelPosition;
 }
 
+template<typename T>
+const arch::ChannelPosition<T>& DropletBoundary<T>::getChannelPosition() const {
+    return channelPosition;
+}
+
 template<typename T>
 T DropletBoundary<T>::getFlowRate() const {
     return flowRate;
@@ -433,7 +438,7 @@ void DropletBoundary<T>::updateWaitState(arch::Network<T> const& network) {
         // if the flow rate did not change, then check for valid channels
         auto boundaryChannel = channelPosition.getChannel();
         int nodeId = isVolumeTowardsNodeA() ? boundaryChannel->getNodeB() : boundaryChannel->getNodeA();
-        for (auto& channel : network.getChannelsAtNode(nodeId)) {
+        for (auto& channel : network.getAdjacentChannels(nodeId)) {
             // do not consider boundary channel or channel that is not a Normal one
             if (channel == boundaryChannel || channel->getChannelType() != arch::ChannelType::NORMAL) {
                 continue;
@@ -53,6 +53,12 @@ class DropletInjection {
      */
     void setName(std::string name);
 
+    /**
+     * @brief Set time at which the droplet should be injected.
+     * @param[in] injectionTime Time in s elapsed since the start of the simulation.
+     */
+    void setInjectionTime(T injectionTime);
+
     /**
      * @brief Retrieve unique identifier of injection.
      * @return Unique identifier of injection.
@@ -21,6 +21,11 @@ std::string DropletInjection<T>::getName() const {
     return name;
 }
 
+template<typename T>
+void DropletInjection<T>::setInjectionTime(T injectionTime_) {
+    this->injectionTime = injectionTime_;
+}
+
 template<typename T>
 T DropletInjection<T>::getInjectionTime() const {
     return injectionTime;
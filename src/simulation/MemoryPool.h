@@ -0,0 +1,123 @@
+/**
+ * @file MemoryPool.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+/**
+ * @brief Class to define a pool of memory for small objects that are created and destroyed frequently during a simulation,
+ * e.g., events and droplet boundaries. The memory is reserved in large chunks and split into slots, which are sorted into
+ * free lists by their size. Released slots are reused for the next object of the same size, such that the pool does not
+ * request new memory from the heap once the number of simultaneously living objects stops growing.
+ */
+class MemoryPool {
+private:
+    /**
+     * @brief A released slot, that stores the next released slot of the same size.
+     */
+    struct FreeSlot {
+        FreeSlot* next;                             ///< Next released slot of the same size.
+    };
+
+    static constexpr std::size_t alignment = alignof(std::max_align_t);    ///< Alignment of all slots.
+    static constexpr std::size_t maxSlotSize = 512;                         ///< Larger objects are allocated on the heap directly.
+
+    std::size_t chunkSize;                          ///< Size of a chunk in bytes.
+    std::vector<std::unique_ptr<std::byte[]>> chunks;  ///< Chunks of memory reserved from the heap.
+    std::size_t chunkOffset = 0;                    ///< Offset of the unused memory in the last chunk.
+    std::vector<FreeSlot*> freeSlots;               ///< Released slots, sorted by slot size. <slotSize/alignment, first slot>
+    std::size_t nAllocations = 0;                   ///< Number of allocated objects.
+    std::size_t nHeapAllocations = 0;               ///< Number of memory requests from the heap, i.e., chunks and large objects.
+    std::size_t nLiveObjects = 0;                   ///< Number of allocated objects that are not yet released.
+
+    /**
+     * @brief Round a size up to a multiple of the slot alignment.
+     */
+    static std::size_t slotSize(std::size_t size);
+
+public:
+    /**
+     * @brief Constructor of the memory pool.
+     * @param[in] chunkSize Size of the chunks that are reserved from the heap in bytes.
+     */
+    explicit MemoryPool(std::size_t chunkSize = 64 * 1024);
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /**
+     * @brief Allocate memory for an object.
+     * @param[in] size Size of the object in bytes.
+     * @returns Pointer to uninitialized memory, aligned for any object.
+     */
+    void* allocate(std::size_t size);
+
+    /**
+     * @brief Release the memory of an object, which was already destroyed.
+     * @param[in] pointer Pointer to the memory of the object.
+     * @param[in] size Size of the object in bytes, as passed to allocate.
+     */
+    void deallocate(void* pointer, std::size_t size);
+
+    /**
+     * @brief Get the number of objects that were allocated from the pool.
+     * @returns Number of allocations.
+     */
+    std::size_t getAllocations() const;
+
+    /**
+     * @brief Get the number of times the pool requested memory from the heap.
+     * @returns Number of heap allocations.
+     */
+    std::size_t getHeapAllocations() const;
+
+    /**
+     * @brief Get the number of allocated objects that are not yet released.
+     * @returns Number of live objects.
+     */
+    std::size_t getLiveObjects() const;
+
+    /**
+     * @brief Get the memory reserved by the pool in chunks.
+     * @returns Reserved memory in bytes.
+     */
+    std::size_t getReservedBytes() const;
+};
+
+/**
+ * @brief Deleter of objects that were constructed in the memory of a pool. Without a pool, the object is deleted regularly.
+ * The size of the allocation is stored in the deleter, such that objects can be destroyed through a pointer to their base class.
+ */
+template<typename U>
+struct PoolDeleter {
+    MemoryPool* pool = nullptr;     ///< Pool that owns the memory of the object.
+    std::size_t size = 0;           ///< Size of the allocation in bytes.
+
+    void operator()(U* pointer) const;
+};
+
+/**
+ * @brief Pointer that owns an object, which may be constructed in the memory of a pool.
+ */
+template<typename U>
+using PoolPtr = std::unique_ptr<U, PoolDeleter<U>>;
+
+/**
+ * @brief Construct an object in the memory of a pool.
+ * @param[in] pool Pool that provides the memory. Without a pool, the object is allocated on the heap.
+ * @param[in] args Arguments of the constructor of the object.
+ * @returns Pointer that owns the object.
+ */
+template<typename Base, typename U, typename... Args>
+PoolPtr<Base> makePooled(MemoryPool* pool, Args&&... args);
+
+}  // namespace sim
@@ -0,0 +1,94 @@
+#include "MemoryPool.h"
+
+namespace sim {
+
+inline MemoryPool::MemoryPool(std::size_t chunkSize) : chunkSize(slotSize(chunkSize)) { }
+
+inline std::size_t MemoryPool::slotSize(std::size_t size) {
+    return (std::max<std::size_t>(size, sizeof(FreeSlot)) + alignment - 1) / alignment * alignment;
+}
+
+inline void* MemoryPool::allocate(std::size_t size) {
+    nAllocations++;
+    nLiveObjects++;
+    std::size_t slot = slotSize(size);
+    if (slot > maxSlotSize) {
+        nHeapAllocations++;
+        return ::operator new(slot);
+    }
+
+    // reuse a released slot of the same size
+    std::size_t index = slot / alignment;
+    if (index < freeSlots.size() && freeSlots[index] != nullptr) {
+        FreeSlot* free = freeSlots[index];
+        freeSlots[index] = free->next;
+        return free;
+    }
+
+    // otherwise take a new slot from the last chunk
+    if (chunks.empty() || chunkOffset + slot > chunkSize) {
+        nHeapAllocations++;
+        chunks.emplace_back(new std::byte[chunkSize]);
+        chunkOffset = 0;
+    }
+    void* pointer = chunks.back().get() + chunkOffset;
+    chunkOffset += slot;
+    return pointer;
+}
+
+inline void MemoryPool::deallocate(void* pointer, std::size_t size) {
+    nLiveObjects--;
+    std::size_t slot = slotSize(size);
+    if (slot > maxSlotSize) {
+        ::operator delete(pointer);
+        return;
+    }
+
+    std::size_t index = slot / alignment;
+    if (index >= freeSlots.size()) {
+        freeSlots.resize(maxSlotSize / alignment + 1, nullptr);
+    }
+    freeSlots[index] = ::new (pointer) FreeSlot{ freeSlots[index] };
+}
+
+inline std::size_t MemoryPool::getAllocations() const {
+    return nAllocations;
+}
+
+inline std::size_t MemoryPool::getHeapAllocations() const {
+    return nHeapAllocations;
+}
+
+inline std::size_t MemoryPool::getLiveObjects() const {
+    return nLiveObjects;
+}
+
+inline std::size_t MemoryPool::getReservedBytes() const {
+    return chunks.size() * chunkSize;
+}
+
+template<typename U>
+void PoolDeleter<U>::operator()(U* pointer) const {
+    if (pool == nullptr) {
+        delete pointer;
+        return;
+    }
+    pointer->~U();
+    pool->deallocate(pointer, size);
+}
+
+template<typename Base, typename U, typename... Args>
+PoolPtr<Base> makePooled(MemoryPool* pool, Args&&... args) {
+    if (pool == nullptr) {
+        return PoolPtr<Base>(new U(std::forward<Args>(args)...), PoolDeleter<Base>{ nullptr, sizeof(U) });
+    }
+    void* memory = pool->allocate(sizeof(U));
+    try {
+        return PoolPtr<Base>(::new (memory) U(std::forward<Args>(args)...), PoolDeleter<Base>{ pool, sizeof(U) });
+    } catch (...) {
+        pool->deallocate(memory, sizeof(U));
+        throw;
+    }
+}
+
+}  // namespace sim
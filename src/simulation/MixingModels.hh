@@ -70,7 +70,7 @@ void InstantaneousMixingModel<T>::propagateSpecies(arch::Network<T>* network, Si
 
     // Define total inflow volume at nodes
     for (auto& [nodeId, node] : network->getNodes()) {
-        for (auto& channel : network->getChannelsAtNode(nodeId) ) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             // Check if the channel flows into the node
             if ((channel->getFlowRate() > 0.0 && channel->getNodeB() == nodeId) || (channel->getFlowRate() < 0.0 && channel->getNodeA() == nodeId)) {
                 T inflowVolume = std::abs(channel->getFlowRate());
@@ -136,7 +136,7 @@ void InstantaneousMixingModel<T>::initNodeOutflow(Simulation<T>* sim, std::vecto
 template<typename T>
 void InstantaneousMixingModel<T>::channelPropagation(arch::Network<T>* network) {
     for (auto& [nodeId, mixtureId] : mixtureOutflowAtNode) {
-        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             // Find the nodeId that is across the channel
             int oppositeNode;
             if (channel->getFlowRate() > 0.0 && channel->getNodeA() == nodeId) {
@@ -332,7 +332,7 @@ template<typename T>
 void InstantaneousMixingModel<T>::updateChannelInflow(T timeStep, arch::Network<T>* network, std::unordered_map<int, std::unique_ptr<Mixture<T>>>& mixtures) {
 
     for (auto& [nodeId, node] : network->getNodes()) {
-        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             // check if edge is an outflow edge to this node
             if ((channel->getFlowRate() > 0.0 && channel->getNodeA() == nodeId) || (channel->getFlowRate() < 0.0 && channel->getNodeB() == nodeId)) {
                 if (mixtureOutflowAtNode.count(nodeId)) {
@@ -347,7 +347,7 @@ template<typename T>
 void InstantaneousMixingModel<T>::clean(arch::Network<T>* network) {
     
     for (auto& [nodeId, node] : network->getNodes()) {
-        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             if (this->mixturesInEdge.count(channel->getId())){
                 for (auto& [mixtureId, endPos] : this->mixturesInEdge.at(channel->getId())) {
                     if (endPos == 1.0) {
@@ -480,7 +480,7 @@ void DiffusionMixingModel<T>::topologyAnalysis( arch::Network<T>* network, int n
 
         // 1. List all connecting channels with angle and inflow
         std::vector<RadialPosition<T>> channelOrder;
-        for (auto& [channelId, channel] : network->getChannels()) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             bool inflow;
             arch::Node<T>* nodeA = network->getNode(channel->getNodeA()).get();
             arch::Node<T>* nodeB = network->getNode(channel->getNodeB()).get();
@@ -878,7 +878,7 @@ void DiffusionMixingModel<T>::printTopology() {
 template<typename T>
 void DiffusionMixingModel<T>::clean(arch::Network<T>* network) {
     for (auto& [nodeId, node] : network->getNodes()) {
-        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+        for (auto& channel : network->getAdjacentChannels(nodeId)) {
             if (this->mixturesInEdge.count(channel->getId())){
                 for (auto& [mixtureId, endPos] : this->mixturesInEdge.at(channel->getId())) {
                     if (endPos == 1.0) {
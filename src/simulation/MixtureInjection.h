@@ -54,6 +54,12 @@ class MixtureInjection {
      */
     void setName(std::string name);
 
+    /**
+     * @brief Set time at which the fluid should be injected.
+     * @param[in] injectionTime Time in s elapsed since the start of the simulation.
+     */
+    void setInjectionTime(T injectionTime);
+
     /**
      * @brief Retrieve unique identifier of injection.
      * @return Unique identifier of injection.
@@ -20,6 +20,11 @@ std::string MixtureInjection<T>::getName() const {
     return name;
 }
 
+template<typename T>
+void MixtureInjection<T>::setInjectionTime(T injectionTime_) {
+    this->injectionTime = injectionTime_;
+}
+
 template<typename T>
 T MixtureInjection<T>::getInjectionTime() const {
     return injectionTime;
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <math.h>
@@ -11,6 +13,8 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace arch {
@@ -28,6 +32,9 @@ class Network;
 template<typename T>
 class Opening;
 
+template<typename T>
+class RectangularChannel;
+
 }
 
 namespace mmft {
@@ -39,6 +46,9 @@ class Scheme;
 template<typename T>
 class NaiveScheme;
 
+template<typename T>
+class AitkenScheme;
+
 }
 
 namespace nodal {
@@ -55,6 +65,9 @@ namespace result {
 template<typename T>
 class SimulationResult;
 
+template<typename T>
+class StateSink;
+
 }
 
 namespace sim {
@@ -66,18 +79,28 @@ class CFDSimulator;
 template<typename T>
 class Droplet;
 
+template<typename T>
+class DropletBoundary;
+
 template<typename T>
 class DropletInjection;
 
+enum class DropletState;
+
 template<typename T>
 class Event;
 
+template<typename T>
+class EventScheduler;
+
 template<typename T>
 class Fluid;
 
 template<typename T>
 class lbmSimulator;
 
+class MemoryPool;
+
 template<typename T>
 class lbmMixingSimulator;
 
@@ -99,6 +122,8 @@ class Mixture;
 template<typename T>
 class MixtureInjection;
 
+class ThreadPool;
+
 template<typename T>
 class ResistanceModel;
 
@@ -121,6 +146,15 @@ enum class Platform {
     Ooc             ///< A simulation with organic tissue
 };
 
+/**
+ * @brief Struct that contains the wall-clock times of the phases of the last simulate() call in s.
+ */
+struct SimulationTimings {
+    double initialize = 0.0;        ///< Initialization of the channels, the nodal analysis and the CFD simulators.
+    double nodalAnalysis = 0.0;     ///< All nodal analyses after the initialization.
+    double eventLoop = 0.0;         ///< The remaining simulation loop, i.e., event computation, CFD steps and state storage.
+};
+
 /**
  * @brief Class that conducts the simulation and owns all parameters necessary for it.
  */
@@ -145,7 +179,7 @@ private:
     MixingModel<T>* mixingModel;                                                        ///< The mixing model used for a mixing simulation.
     std::unordered_map<int, std::shared_ptr<mmft::Scheme<T>>> updateSchemes;            ///< The update scheme for Abstract-CFD coupling
     int continuousPhase = 0;                                                            ///< Fluid of the continuous phase.
-    int iteration = 0;
+    int iteration = 0;                                                                  ///< Number of iterations of the last simulate() call.
     int maxIterations = 1e5;
     T maximalAdaptiveTimeStep = 0;                                                      ///< Maximal adaptive time step that is applied when droplets change the channel.
     T time = 0.0;                                                                       ///< Current time of the simulation.
@@ -155,7 +189,38 @@ private:
     bool writePpm = true;
     bool eventBasedWriting = false;
     bool dropletsAtBifurcation = false;                                  ///< If one or more droplets are currently at a bifurcation. Triggers the usage of the maximal adaptive time step.
+    int maxIncrementalNodalUpdates = 20;                                                ///< Maximal number of low-rank updates of the nodal analysis between two factorizations in droplet simulations.
+    int cfdThreads = 1;                                                                 ///< Number of threads that solve the CFD simulators concurrently in hybrid simulations.
+    std::unique_ptr<ThreadPool> cfdThreadPool = nullptr;                                ///< Thread pool that solves the CFD simulators, if more than one thread is used.
     std::unique_ptr<result::SimulationResult<T>> simulationResult = nullptr;
+    std::vector<std::shared_ptr<result::StateSink<T>>> stateSinks;                      ///< Sinks to which each state is written when it is saved.
+    SimulationTimings timings;                                                          ///< Wall-clock times of the phases of the last simulate() call.
+
+    /**
+     * @brief The state of a droplet that determines its events. The events of a droplet are only recomputed when it changes.
+     */
+    struct DropletSignature {
+        DropletState state;
+        std::vector<std::tuple<DropletBoundary<T>*, int, bool, T, bool, Droplet<T>*>> boundaries;  ///< <boundary, channelId, volumeTowardsNodeA, flowRate, inWaitState, mergeDroplet>
+
+        bool operator==(const DropletSignature& other) const { return state == other.state && boundaries == other.boundaries; }
+    };
+
+    std::shared_ptr<MemoryPool> memoryPool;                                             ///< Pool in which the events and droplet boundaries of the droplet simulation are allocated.
+    EventScheduler<T> eventScheduler;                                                   ///< Events of the droplet simulation, which persist across iterations.
+    std::unordered_map<int, DropletSignature> dropletSignatures;                        ///< State of the droplets when their events were computed.
+    std::unordered_map<int, std::vector<std::pair<DropletBoundary<T>*, Droplet<T>*>>> channelBoundaries;  ///< Boundaries inside the channels sorted by their position. <channelId, <boundary, droplet>>
+
+    std::vector<arch::RectangularChannel<T>*> dropletChannels;                         ///< Channels that contained droplets at the last update of the droplet resistances, sorted by id.
+    std::vector<T> dropletChannelResistances;                                           ///< Resistances of these channels after the last update.
+    std::vector<arch::RectangularChannel<T>*> occupiedChannels;                        ///< Channels that contain droplets, buffer of updateDropletResistances().
+    std::vector<int> changedResistances;                                                ///< Ids of the channels whose resistance changed in the last update of the droplet resistances.
+
+    // buffers of updateEvents(), which keep their capacity across iterations
+    std::vector<std::tuple<int, int, Droplet<T>*>> nodeDroplets;                       ///< Droplets that span over a node, sorted by node. <nodeId, order, droplet>
+    std::vector<int> changedChannels;                                                   ///< Channels in which boundaries changed.
+    std::vector<Droplet<T>*> changedDroplets;                                           ///< Droplets inside the network whose events changed.
+    DropletSignature signature;                                                         ///< Signature of the droplet that is currently checked.
 
     /**
      * @brief Initializes the resistance model and the channel resistances of the empty channels.
@@ -164,13 +229,30 @@ private:
 
     /**
      * @brief Update the droplet resistances of the channels based on the current positions of the droplets.
+     * Only the channels that contain droplets now or at the last update are recomputed, the ids of the channels whose
+     * resistance changed are collected in changedResistances.
      */
     void updateDropletResistances();
 
     /**
-     * @brief Compute all possible next events.
+     * @brief Update the scheduled events of the droplet simulation. Only the events of injections, droplets and channels
+     * that changed since the last update are recomputed.
+     */
+    void updateEvents();
+
+    /**
+     * @brief Insert a droplet boundary into the boundaries of its channel, sorted by position.
+     * @param[in] boundary The droplet boundary.
+     * @param[in] droplet The droplet of the boundary.
      */
-    std::vector<std::unique_ptr<Event<T>>> computeEvents();
+    void insertChannelBoundary(DropletBoundary<T>* boundary, Droplet<T>* droplet);
+
+    /**
+     * @brief Remove a droplet boundary from the boundaries of a channel.
+     * @param[in] channelId Id of the channel in which the boundary was inserted.
+     * @param[in] boundary The droplet boundary.
+     */
+    void removeChannelBoundary(int channelId, DropletBoundary<T>* boundary);
 
     /**
      * @brief Compute all possible next events for mixing simulation.
@@ -317,6 +399,25 @@ public:
      */
     std::shared_ptr<mmft::NaiveScheme<T>> setNaiveHybridScheme(int moduleId, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int theta);
 
+    /**
+     * @brief Define and set the Aitken update scheme with adaptive theta for a hybrid simulation.
+     * @param[in] alpha The initial relaxation value for the pressure value update for all nodes.
+     * @param[in] beta The initial relaxation value for the flow rate value update for all nodes.
+     * @param[in] theta The initial amount of LBM stream and collide cycles between updates for all modules.
+     * @returns A shared_ptr to the created Aitken update scheme.
+     */
+    std::shared_ptr<mmft::AitkenScheme<T>> setAitkenHybridScheme(T alpha, T beta, int theta);
+
+    /**
+     * @brief Define and set the Aitken update scheme with adaptive theta for a hybrid simulation.
+     * @param[in] moduleId The id of the module for which the update scheme is set.
+     * @param[in] alpha The initial relaxation value for the pressure value update for all nodes of the module.
+     * @param[in] beta The initial relaxation value for the flow rate value update for all nodes of the module.
+     * @param[in] theta The initial amount of LBM stream and collide cycles between updates for the module.
+     * @returns A shared_ptr to the created Aitken update scheme.
+     */
+    std::shared_ptr<mmft::AitkenScheme<T>> setAitkenHybridScheme(int moduleId, T alpha, T beta, int theta);
+
     /**
      * @brief Create injection.
      * @param[in] dropletId Id of the droplet that should be injected.
@@ -458,6 +559,44 @@ public:
      */
     void setMixingModel(MixingModel<T>* model);
 
+    /**
+     * @brief Define how many consecutive nodal analyses of a droplet simulation may be solved by low-rank updates of the previous
+     * factorization, when only few channel resistances changed.
+     * @param[in] maxUpdates Maximal number of updates between two factorizations (0 always refactorizes the system).
+     */
+    void setMaxIncrementalNodalUpdates(int maxUpdates);
+
+    /**
+     * @brief Define the number of threads that solve the CFD simulators of a hybrid simulation concurrently.
+     * @param[in] nThreads Number of threads (1 solves the simulators sequentially, 0 uses all hardware threads).
+     */
+    void setCfdThreads(int nThreads);
+
+    /**
+     * @brief Add a sink, to which each state is written when it is saved, e.g., to stream the states of long simulations to a file.
+     * Combined with setRetainedStates of the simulation result, only the most recent states are kept in memory.
+     * @param[in] sink The sink.
+     */
+    void addStateSink(std::shared_ptr<result::StateSink<T>> sink);
+
+    /**
+     * @brief Get the wall-clock times of the initialization, the nodal analyses and the simulation loop of the last simulate() call.
+     * @returns The timings of the simulation phases.
+     */
+    const SimulationTimings& getTimings() const;
+
+    /**
+     * @brief Get the pool in which the events and droplet boundaries of droplet simulations are allocated, e.g., to inspect its allocation counts.
+     * @returns The memory pool of the simulation.
+     */
+    const MemoryPool& getMemoryPool() const;
+
+    /**
+     * @brief Get the number of iterations of the last simulate() call, i.e., the coupling iterations between the nodal analysis and the CFD simulators of a hybrid simulation, or the iterations of the event loop of a droplet or mixing simulation.
+     * @returns Number of iterations.
+     */
+    int getIterations() const;
+
     /**
      * @brief Calculate and set new state of the continuous fluid simulation. Move mixture positions and create new mixtures if necessary.
      * @param[in] timeStep Time step in s for which the new mixtures state should be calculated.
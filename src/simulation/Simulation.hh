@@ -5,6 +5,8 @@ namespace sim {
     template<typename T>
     Simulation<T>::Simulation() {
         this->simulationResult = std::make_unique<result::SimulationResult<T>>();
+        this->memoryPool = std::make_shared<MemoryPool>();
+        eventScheduler.setMemoryPool(memoryPool);
     }
 
     template<typename T>
@@ -21,7 +23,7 @@ namespace sim {
         auto id = droplets.size();
         auto fluid = fluids.at(fluidId).get();
 
-        auto result = droplets.insert_or_assign(id, std::make_unique<Droplet<T>>(id, volume, fluid));
+        auto result = droplets.insert_or_assign(id, std::make_unique<Droplet<T>>(id, volume, fluid, memoryPool));
 
         return result.first->second.get();
     }
@@ -224,6 +226,24 @@ namespace sim {
         return naiveScheme;
     }
 
+    template<typename T>
+    std::shared_ptr<mmft::AitkenScheme<T>> Simulation<T>::setAitkenHybridScheme(T alpha, T beta, int theta) {
+        auto aitkenScheme = std::make_shared<mmft::AitkenScheme<T>>(network->getModules(), alpha, beta, theta);
+        for (auto& [key, simulator] : cfdSimulators) {
+            updateSchemes.insert_or_assign(simulator->getId(), aitkenScheme);
+            simulator->setUpdateScheme(updateSchemes.at(simulator->getId()));
+        }
+        return aitkenScheme;
+    }
+
+    template<typename T>
+    std::shared_ptr<mmft::AitkenScheme<T>> Simulation<T>::setAitkenHybridScheme(int moduleId, T alpha, T beta, int theta) {
+        auto aitkenScheme = std::make_shared<mmft::AitkenScheme<T>>(network->getModule(moduleId), alpha, beta, theta);
+        updateSchemes.insert_or_assign(moduleId, aitkenScheme);
+        cfdSimulators.at(moduleId)->setUpdateScheme(updateSchemes.at(moduleId));
+        return aitkenScheme;
+    }
+
     template<typename T>
     lbmSimulator<T>* Simulation<T>::addLbmSimulator(std::string name, std::string stlFile, std::shared_ptr<arch::Module<T>> module, std::unordered_map<int, arch::Opening<T>> openings, 
                                                     T charPhysLength, T charPhysVelocity, T resolution, T epsilon, T tau)
@@ -351,6 +371,39 @@ namespace sim {
     void Simulation<T>::setMixingModel(MixingModel<T>* model_) {
         this->mixingModel = model_;
     }
+
+    template<typename T>
+    void Simulation<T>::setMaxIncrementalNodalUpdates(int maxUpdates_) {
+        this->maxIncrementalNodalUpdates = maxUpdates_;
+    }
+
+    template<typename T>
+    void Simulation<T>::setCfdThreads(int nThreads_) {
+        if (nThreads_ < 0) {
+            throw std::invalid_argument("The number of CFD threads must be non-negative.");
+        }
+        this->cfdThreads = nThreads_;
+    }
+
+    template<typename T>
+    void Simulation<T>::addStateSink(std::shared_ptr<result::StateSink<T>> sink) {
+        stateSinks.push_back(std::move(sink));
+    }
+
+    template<typename T>
+    const SimulationTimings& Simulation<T>::getTimings() const {
+        return timings;
+    }
+
+    template<typename T>
+    const MemoryPool& Simulation<T>::getMemoryPool() const {
+        return *memoryPool;
+    }
+
+    template<typename T>
+    int Simulation<T>::getIterations() const {
+        return iteration;
+    }
     
     template<typename T>
     void Simulation<T>::calculateNewMixtures(double timestep_) {
@@ -585,8 +638,14 @@ namespace sim {
     template<typename T>
     void Simulation<T>::simulate() {
 
+        auto start = std::chrono::steady_clock::now();
+
         // initialize the simulation
         initialize();
+        iteration = 0;
+
+        auto initialized = std::chrono::steady_clock::now();
+        double initialNodalTime = nodalAnalysis->getElapsedTime();
         //printResults();
 
         // Abstract continuous simulation
@@ -614,14 +673,15 @@ namespace sim {
 
             // Initialization of CFD domains
             while (! allConverged) {
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
             }
 
             while (! allConverged || !pressureConverged) {
                 // conduct CFD simulations
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
                 // compute nodal analysis again
                 pressureConverged = nodalAnalysis->conductNodalAnalysis(cfdSimulators);
+                iteration++;
 
             }
 
@@ -637,6 +697,9 @@ namespace sim {
                 writeVelocityPpm(getGlobalVelocityBounds());
             }
 
+            // Wait for the vtk output that is written in the background
+            flushVtkOutput(cfdSimulators);
+
             saveState();
         }
 
@@ -653,15 +716,16 @@ namespace sim {
 
             // Initialization of NS CFD domains
             while (! allConverged) {
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
             }
 
             // Obtain overal steady-state flow result
             while (! allConverged || !pressureConverged) {
                 // conduct CFD simulations
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
                 // compute nodal analysis again
                 pressureConverged = nodalAnalysis->conductNodalAnalysis(cfdSimulators);
+                iteration++;
             }
 
             #ifdef VERBOSE     
@@ -677,12 +741,12 @@ namespace sim {
             saveState();
 
             // Couple the resulting CFD flow field to the AD fields
-            coupleNsAdLattices(cfdSimulators);
+            coupleNsAdLattices(cfdSimulators, cfdThreadPool.get());
 
             // Obtain overal steady-state concentration results
             bool concentrationConverged = false;
             while (!concentrationConverged) {
-                concentrationConverged = conductADSimulation(cfdSimulators);
+                concentrationConverged = conductADSimulation(cfdSimulators, cfdThreadPool.get());
                 this->mixingModel->propagateSpecies(network, this);
             }
         }
@@ -700,14 +764,15 @@ namespace sim {
 
             // Initialization of CFD domains
             while (! allConverged) {
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
             }
 
             while (! allConverged || !pressureConverged) {
                 // conduct CFD simulations
-                allConverged = conductCFDSimulation(cfdSimulators);
+                allConverged = conductCFDSimulation(cfdSimulators, cfdThreadPool.get());
                 // compute nodal analysis again
                 pressureConverged = nodalAnalysis->conductNodalAnalysis(cfdSimulators);
+                iteration++;
             }
 
             #ifdef VERBOSE     
@@ -738,6 +803,12 @@ namespace sim {
         // * perform event
         if (simType == Type::Abstract && platform == Platform::BigDroplet) {
 
+            eventScheduler.clear();
+            dropletSignatures.clear();
+            channelBoundaries.clear();
+            // the droplet resistances of all channels were reset by initialize()
+            dropletChannels.clear();
+
             while (true) {
                 if (iteration >= maxIterations) {
                     throw "Max iterations exceeded.";
@@ -748,8 +819,8 @@ namespace sim {
                 #endif
                 // update droplet resistances (in the first iteration no  droplets are inside the network)
                 updateDropletResistances();
-                // compute nodal analysis
-                nodalAnalysis->conductNodalAnalysis();
+                // compute nodal analysis, only the channels with changed resistances are reassembled
+                nodalAnalysis->conductNodalAnalysis(changedResistances);
                 // update droplets, i.e., their boundary flow rates
                 // loop over all droplets
                 dropletsAtBifurcation = false;
@@ -771,36 +842,30 @@ namespace sim {
                 }
                 // store simulation results of current state
                 saveState();
-                // compute events
-                auto events = computeEvents();
-                // sort events
+                // update the events of the droplets that changed
+                updateEvents();
+
+                // get next event or break loop, if no events remain
                 // closest events in time with the highest priority come first
-                std::sort(events.begin(), events.end(), [](auto& a, auto& b) {
-                    if (a->getTime() == b->getTime()) {
-                        return a->getPriority() < b->getPriority();  // ascending order (the lower the priority value, the higher the priority)
-                    }
-                    return a->getTime() < b->getTime();  // ascending order
-                });
+                T timeStep = 0.0;
+                Event<T>* nextEvent = eventScheduler.next(time, timeStep);
+                if (nextEvent == nullptr) {
+                    break;
+                }
 
                 #ifdef DEBUG     
-                    for (auto& event : events) {
-                        event->print();
-                    }
+                    nextEvent->print();
                 #endif
 
-                // get next event or break loop, if no events remain
-                Event<T>* nextEvent = nullptr;
-                if (events.size() != 0) {
-                    nextEvent = events[0].get();
-                } else {
-                    break;
-                }
                 // move droplets until event is reached
-                time += nextEvent->getTime();
-                moveDroplets(nextEvent->getTime());
+                time += timeStep;
+                moveDroplets(timeStep);
 
                 nextEvent->performEvent();
 
+                // the events of the group of the performed event are recomputed in the next iteration
+                eventScheduler.invalidateNext();
+
                 iteration++;
             }
         }
@@ -877,6 +942,17 @@ namespace sim {
                 // Store the mixtures that were in the simulation
                 saveMixtures();
         }
+
+        // write the states that are still buffered by the sinks
+        for (auto& sink : stateSinks) {
+            sink->flush();
+        }
+
+        // the nodal analyses of the initialization are part of the initialization time
+        auto end = std::chrono::steady_clock::now();
+        timings.initialize = std::chrono::duration<double>(initialized - start).count();
+        timings.nodalAnalysis = nodalAnalysis->getElapsedTime() - initialNodalTime;
+        timings.eventLoop = std::chrono::duration<double>(end - initialized).count() - timings.nodalAnalysis;
     }
 
     template<typename T>
@@ -918,8 +994,27 @@ namespace sim {
             channel->setDropletResistance(0.0);
         }
 
+        // the topology of the network is final, build the CSR view used by the solver and the simulation engines
+        network->freeze();
+
         nodalAnalysis = std::make_shared<nodal::NodalAnalysis<T>> (network);
 
+        // the nodal analysis is repeated with an unchanged sparsity pattern, hence its symbolic factorization is reused
+        if (this->simType == Type::Hybrid || this->platform == Platform::BigDroplet) {
+            nodalAnalysis->setFactorizationReuse(true);
+        }
+
+        // droplet events usually change the resistance of few channels, which is handled by low-rank updates
+        if (this->platform == Platform::BigDroplet) {
+            nodalAnalysis->setIncrementalUpdates(maxIncrementalNodalUpdates);
+        }
+
+        // the CFD simulators of the modules are independent between two nodal analyses and can be solved concurrently
+        if (this->simType == Type::Hybrid && cfdThreads != 1 && cfdSimulators.size() > 1) {
+            unsigned int nThreads = (cfdThreads > 0) ? cfdThreads : std::max(1u, std::thread::hardware_concurrency());
+            cfdThreadPool = std::make_unique<ThreadPool>(std::min<unsigned int>(nThreads, cfdSimulators.size()));
+        }
+
         if (this->simType == Type::Hybrid && this->platform == Platform::Continuous) {
             
             #ifdef VERBOSE
@@ -1010,12 +1105,13 @@ namespace sim {
 
     template<typename T>
     void Simulation<T>::updateDropletResistances() {
-        // set all droplet resistances of all channels to 0.0
-        for (auto& [key, channel] : network->getChannels()) {
+        // only the channels that contained droplets at the last update have a droplet resistance
+        for (auto* channel : dropletChannels) {
             channel->setDropletResistance(0.0);
         }
 
         // set correct droplet resistances
+        occupiedChannels.clear();
         for (auto& [key, droplet] : droplets) {
             // only consider droplets that are inside the network (i.e., also trapped droplets)
             if (droplet->getDropletState() == DropletState::INJECTION || droplet->getDropletState() == DropletState::SINK) {
@@ -1023,6 +1119,46 @@ namespace sim {
             }
 
             droplet->addDropletResistance(*resistanceModel);
+
+            for (auto& boundary : droplet->getBoundaries()) {
+                occupiedChannels.push_back(boundary->getChannelPosition().getChannel());
+            }
+            for (auto* channel : droplet->getFullyOccupiedChannels()) {
+                occupiedChannels.push_back(channel);
+            }
+        }
+        auto byId = [](const arch::RectangularChannel<T>* a, const arch::RectangularChannel<T>* b) { return a->getId() < b->getId(); };
+        std::sort(occupiedChannels.begin(), occupiedChannels.end(), byId);
+        occupiedChannels.erase(std::unique(occupiedChannels.begin(), occupiedChannels.end()), occupiedChannels.end());
+
+        // a channel changed if its resistance differs from the last update, or if droplets entered it since then
+        changedResistances.clear();
+        size_t previous = 0;
+        for (auto* channel : occupiedChannels) {
+            for (; previous < dropletChannels.size() && byId(dropletChannels[previous], channel); ++previous) {
+                if (dropletChannels[previous]->getResistance() != dropletChannelResistances[previous]) {
+                    changedResistances.push_back(dropletChannels[previous]->getId());
+                }
+            }
+            if (previous < dropletChannels.size() && dropletChannels[previous] == channel) {
+                if (channel->getResistance() != dropletChannelResistances[previous]) {
+                    changedResistances.push_back(channel->getId());
+                }
+                ++previous;
+            } else {
+                changedResistances.push_back(channel->getId());
+            }
+        }
+        for (; previous < dropletChannels.size(); ++previous) {
+            if (dropletChannels[previous]->getResistance() != dropletChannelResistances[previous]) {
+                changedResistances.push_back(dropletChannels[previous]->getId());
+            }
+        }
+
+        dropletChannels.swap(occupiedChannels);
+        dropletChannelResistances.resize(dropletChannels.size());
+        for (size_t i = 0; i < dropletChannels.size(); ++i) {
+            dropletChannelResistances[i] = dropletChannels[i]->getResistance();
         }
     }
 
@@ -1108,17 +1244,29 @@ namespace sim {
         }
         
         // state
+        int id = simulationResult->getStates().getAddedStates();
+        std::unique_ptr<result::State<T>> state = nullptr;
         if (platform == Platform::Continuous) {
             if (simType == Type::Abstract){
-                simulationResult->addState(time, savePressures, saveFlowRates);
+                state = std::make_unique<result::State<T>>(id, time, savePressures, saveFlowRates);
             } else if (simType == Type::Hybrid) {
-                simulationResult->addState(time, savePressures, saveFlowRates, vtkFiles);
+                state = std::make_unique<result::State<T>>(id, time, savePressures, saveFlowRates, vtkFiles);
             }
         } else if (platform == Platform::BigDroplet) {
-            simulationResult->addState(time, savePressures, saveFlowRates, saveDropletPositions);
+            state = std::make_unique<result::State<T>>(id, time, savePressures, saveFlowRates, saveDropletPositions);
         } else if (platform == Platform::Mixing) {
-            simulationResult->addState(time, savePressures, saveFlowRates, saveMixturePositions);
+            auto& filledEdges = simulationResult->updateFilledEdges(saveMixturePositions);
+            state = std::make_unique<result::State<T>>(id, time, savePressures, saveFlowRates, saveMixturePositions, filledEdges);
+        }
+        if (state == nullptr) {
+            return;
         }
+
+        // stream the state to the sinks, before it is stored in the result
+        for (auto& sink : stateSinks) {
+            sink->write(state.get(), this);
+        }
+        simulationResult->addState(std::move(state));
         
     }
 
@@ -1173,36 +1321,91 @@ namespace sim {
     }
 
     template<typename T>
-    std::vector<std::unique_ptr<Event<T>>> Simulation<T>::computeEvents() {
-        // events
-        std::vector<std::unique_ptr<Event<T>>> events;
-
-        // injection events
+    void Simulation<T>::updateEvents() {
+        // injection events, which remain valid until the droplet is injected
         for (auto& [key, injection] : dropletInjections) {
-            double injectionTime = injection->getInjectionTime();
-            if (injection->getDroplet()->getDropletState() == DropletState::INJECTION) {
-                events.push_back(std::make_unique<DropletInjectionEvent<T>>(injectionTime - time, *injection));
+            if (injection->getDroplet()->getDropletState() != DropletState::INJECTION) {
+                eventScheduler.invalidate(EventSource::Injection, key);
+            } else if (!eventScheduler.isScheduled(EventSource::Injection, key)) {
+                double injectionTime = injection->getInjectionTime();
+                eventScheduler.template schedule<DropletInjectionEvent<T>>(EventSource::Injection, key, time, injectionTime - time, *injection);
             }
         }
 
-        // define maps that are used for detecting merging inside channels
-        std::unordered_map<int, std::vector<DropletBoundary<T>*>> channelBoundariesMap;
-        std::unordered_map<DropletBoundary<T>*, Droplet<T>*> boundaryDropletMap;
+        // droplets that span over a node, in the order in which getDropletAtNode finds them
+        // sorted by the node and the order in which the droplets were found, such that the first droplet at a node comes first
+        nodeDroplets.clear();
+        for (auto& [key, droplet] : droplets) {
+            if (droplet->getDropletState() != DropletState::NETWORK || droplet->isInsideSingleChannel()) {
+                continue;
+            }
+            for (auto& boundary : droplet->getBoundaries()) {
+                nodeDroplets.emplace_back(boundary->getReferenceNode(), nodeDroplets.size(), droplet.get());
+            }
+            for (auto& channel : droplet->getFullyOccupiedChannels()) {
+                nodeDroplets.emplace_back(channel->getNodeA(), nodeDroplets.size(), droplet.get());
+                nodeDroplets.emplace_back(channel->getNodeB(), nodeDroplets.size(), droplet.get());
+            }
+        }
+        std::sort(nodeDroplets.begin(), nodeDroplets.end());
+        auto dropletAtNode = [&](int nodeId) -> Droplet<T>* {
+            auto first = std::lower_bound(nodeDroplets.begin(), nodeDroplets.end(), nodeId, [](const auto& entry, int nodeId) { return std::get<0>(entry) < nodeId; });
+            return (first != nodeDroplets.end() && std::get<0>(*first) == nodeId) ? std::get<2>(*first) : nullptr;
+        };
+
+        changedChannels.clear();
+        changedDroplets.clear();
 
         for (auto& [key, droplet] : droplets) {
+            // the events of a droplet only change with its state, i.e., its boundaries, their flow rates and the droplets they merge with
+            signature.state = droplet->getDropletState();
+            signature.boundaries.clear();
+            if (signature.state == DropletState::NETWORK) {
+                for (auto& boundary : droplet->getBoundaries()) {
+                    Droplet<T>* mergeDroplet = dropletAtNode(boundary->getOppositeReferenceNode());
+                    signature.boundaries.emplace_back(boundary.get(), boundary->getChannelPosition().getChannel()->getId(), boundary->isVolumeTowardsNodeA(),
+                                                      boundary->getFlowRate(), boundary->isInWaitState(), mergeDroplet);
+                }
+            }
+
+            auto cached = dropletSignatures.find(key);
+            if (cached != dropletSignatures.end() && cached->second == signature) {
+                continue;
+            }
+
+            // the previous boundaries of the droplet are removed from the channel boundaries and its current boundaries are
+            // inserted after all removals, such that the index never contains two boundaries at the same address
+            // the merge channel events of the channels the droplet enters or leaves change as well
+            if (cached != dropletSignatures.end()) {
+                for (auto& boundary : cached->second.boundaries) {
+                    removeChannelBoundary(std::get<1>(boundary), std::get<0>(boundary));
+                    changedChannels.push_back(std::get<1>(boundary));
+                }
+            }
+            for (auto& boundary : signature.boundaries) {
+                changedChannels.push_back(std::get<1>(boundary));
+            }
+            if (signature.state == DropletState::NETWORK) {
+                changedDroplets.push_back(droplet.get());
+            }
+
+            eventScheduler.invalidate(EventSource::Droplet, key);
+            dropletSignatures.insert_or_assign(key, signature);
+
             // only consider droplets inside the network (but no trapped droplets)
-            if (droplet->getDropletState() != DropletState::NETWORK) {
+            if (signature.state != DropletState::NETWORK) {
                 continue;
             }
 
             // loop through boundaries
-            for (auto& boundary : droplet->getBoundaries()) {
+            for (size_t i = 0; i < signature.boundaries.size(); ++i) {
+                auto& boundary = droplet->getBoundaries()[i];
                 // the flow rate of the boundary indicates if the boundary moves towards or away from the droplet center and, hence, if a BoundaryTailEvent or BoundaryHeadEvent should occur, respectively
                 // if the flow rate of the boundary is 0, then no events will be triggered (the boundary may be in a Wait state)
                 if (boundary->getFlowRate() < 0) {
                     // boundary moves towards the droplet center => BoundaryTailEvent
                     double time = boundary->getTime();
-                    events.push_back(std::make_unique<BoundaryTailEvent<T>>(time, *droplet, *boundary, *network));
+                    eventScheduler.template schedule<BoundaryTailEvent<T>>(EventSource::Droplet, key, this->time, time, *droplet, *boundary, *network);
                 } else if (boundary->getFlowRate() > 0) {
                     // boundary moves away from the droplet center => BoundaryHeadEvent
                     double time = boundary->getTime();
@@ -1210,98 +1413,112 @@ namespace sim {
                     // in this scenario also a MergeBifurcationEvent can happen when merging is enabled
                     // this means a boundary comes to a bifurcation where a droplet is already present
                     // hence it is either a MergeBifurcationEvent or a BoundaryHeadEvent that will happen
-
-                    // check if merging is enabled
-                    Droplet<T>* mergeDroplet = nullptr;
-
-                    // find droplet to merge (if present)
-                    auto referenceNode = boundary->getOppositeReferenceNode(network);
-                    mergeDroplet = getDropletAtNode(referenceNode->getId());
+                    Droplet<T>* mergeDroplet = std::get<5>(signature.boundaries[i]);
 
                     if (mergeDroplet == nullptr) {
                         // no merging will happen => BoundaryHeadEvent
                         if (!boundary->isInWaitState()) {
-                            events.push_back(std::make_unique<BoundaryHeadEvent<T>>(time, *droplet, *boundary, *network));
+                            eventScheduler.template schedule<BoundaryHeadEvent<T>>(EventSource::Droplet, key, this->time, time, *droplet, *boundary, *network);
                         }
                     } else {
                         // merging of the actual droplet with the merge droplet will happen => MergeBifurcationEvent
-                        events.push_back(std::make_unique<MergeBifurcationEvent<T>>(time, *droplet, *mergeDroplet, *boundary, *this));
+                        eventScheduler.template schedule<MergeBifurcationEvent<T>>(EventSource::Droplet, key, this->time, time, *droplet, *mergeDroplet, *boundary, *this);
                     }
                 }
+            }
+        }
 
-                // fill the maps which are later used for merging inside channels (if merging is enabled)
-                auto [value, success] = channelBoundariesMap.try_emplace(boundary->getChannelPosition().getChannel()->getId());
-                value->second.push_back(boundary.get());
-
-                boundaryDropletMap.emplace(boundary.get(), droplet.get());
+        for (auto* droplet : changedDroplets) {
+            for (auto& boundary : droplet->getBoundaries()) {
+                insertChannelBoundary(boundary.get(), droplet);
             }
         }
 
         // check for MergeChannelEvents, i.e, for boundaries of other droplets that are in the same channel
-        // here the previously defined maps are used => if merging is not enabled these maps are emtpy
-        // loop through channelsBoundariesMap
-        for (auto& [channelId, boundaries] : channelBoundariesMap) {
-            // loop through boundaries that are inside this channel
-            for (size_t i = 0; i < boundaries.size(); i++) {
+        // only the channels in which boundaries changed are checked again
+        std::sort(changedChannels.begin(), changedChannels.end());
+        changedChannels.erase(std::unique(changedChannels.begin(), changedChannels.end()), changedChannels.end());
+        for (int channelId : changedChannels) {
+            eventScheduler.invalidate(EventSource::Channel, channelId);
+            auto boundaries = channelBoundaries.find(channelId);
+            if (boundaries == channelBoundaries.end()) {
+                continue;
+            }
+
+            // the boundaries are sorted by their position and cannot pass each other without merging,
+            // hence, the first merging inside a channel always happens between neighbouring boundaries
+            for (size_t i = 0; i + 1 < boundaries->second.size(); i++) {
                 // get reference boundary and droplet
-                auto referenceBoundary = boundaries[i];
-                auto referenceDroplet = boundaryDropletMap.at(referenceBoundary);
+                auto [referenceBoundary, referenceDroplet] = boundaries->second[i];
+                auto [boundary, droplet] = boundaries->second[i + 1];
+
+                // do not consider if this boundary is form the same droplet
+                if (droplet == referenceDroplet) {
+                    continue;
+                }
 
                 // get channel
                 auto channel = referenceBoundary->getChannelPosition().getChannel();
 
-                // get velocity and absolute position of the boundary
-                // positive values for v0 indicate a movement from node0 towards node1
+                // get velocity and absolute position of the boundaries
+                // positive values for v0 and v1 indicate a movement from node0 towards node1
                 auto q0 = referenceBoundary->isVolumeTowardsNodeA() ? referenceBoundary->getFlowRate() : -referenceBoundary->getFlowRate();
                 auto v0 = q0 / channel->getArea();
                 auto p0 = referenceBoundary->getChannelPosition().getPosition() * channel->getLength();
+                auto q1 = boundary->isVolumeTowardsNodeA() ? boundary->getFlowRate() : -boundary->getFlowRate();
+                auto v1 = q1 / channel->getArea();
+                auto p1 = boundary->getChannelPosition().getPosition() * channel->getLength();
 
-                // compare reference boundary against all others
-                // the two loops are defined in such a way, that only one merge event happens for a pair of boundaries
-                for (size_t j = i + 1; j < boundaries.size(); j++) {
-                    auto boundary = boundaries[j];
-                    auto droplet = boundaryDropletMap.at(boundary);
-
-                    // do not consider if this boundary is form the same droplet
-                    if (droplet == referenceDroplet) {
-                        continue;
-                    }
-
-                    // get velocity and absolute position of the boundary
-                    // positive values for v0 indicate a movement from node0 towards node1
-                    auto q1 = boundary->isVolumeTowardsNodeA() ? boundary->getFlowRate() : -boundary->getFlowRate();
-                    auto v1 = q1 / channel->getArea();
-                    auto p1 = boundary->getChannelPosition().getPosition() * channel->getLength();
-
-                    // do not merge when both velocities are equal (would result in infinity time)
-                    if (v0 == v1) {
-                        continue;
-                    }
-
-                    // compute time and merge position
-                    auto time = (p1 - p0) / (v0 - v1);
-                    auto pMerge = p0 + v0 * time;  // or p1 + v1*time
-                    auto pMergeRelative = pMerge / channel->getLength();
+                // do not merge when both velocities are equal (would result in infinity time)
+                if (v0 == v1) {
+                    continue;
+                }
 
-                    // do not trigger a merge event when:
-                    // * time is negative => indicates that both boundaries go in different directions or that one boundary cannot "outrun" the other because it is too slow
-                    // * relative merge position is outside the range of [0, 1] => the merging would happen "outside" the channel and a boundary would already switch a channel before this event could happen
-                    if (time < 0 || pMergeRelative < 0 || 1 < pMergeRelative) {
-                        continue;
-                    }
+                // compute time and merge position
+                auto time = (p1 - p0) / (v0 - v1);
+                auto pMerge = p0 + v0 * time;  // or p1 + v1*time
+                auto pMergeRelative = pMerge / channel->getLength();
 
-                    // add MergeChannelEvent
-                    events.push_back(std::make_unique<MergeChannelEvent<T>>(time, *referenceDroplet, *droplet, *referenceBoundary, *boundary, *this));
+                // do not trigger a merge event when:
+                // * time is negative => indicates that both boundaries go in different directions or that one boundary cannot "outrun" the other because it is too slow
+                // * relative merge position is outside the range of [0, 1] => the merging would happen "outside" the channel and a boundary would already switch a channel before this event could happen
+                if (time < 0 || pMergeRelative < 0 || 1 < pMergeRelative) {
+                    continue;
                 }
+
+                // add MergeChannelEvent
+                eventScheduler.template schedule<MergeChannelEvent<T>>(EventSource::Channel, channelId, this->time, time, *referenceDroplet, *droplet, *referenceBoundary, *boundary, *this);
             }
         }
 
         // time step event
+        eventScheduler.invalidate(EventSource::TimeStep, 0);
         if (dropletsAtBifurcation && maximalAdaptiveTimeStep > 0) {
-            events.push_back(std::make_unique<TimeStepEvent<T>>(maximalAdaptiveTimeStep));
+            eventScheduler.template schedule<TimeStepEvent<T>>(EventSource::TimeStep, 0, time, maximalAdaptiveTimeStep);
         }
+    }
 
-        return events;
+    template<typename T>
+    void Simulation<T>::insertChannelBoundary(DropletBoundary<T>* boundary, Droplet<T>* droplet) {
+        auto& boundaries = channelBoundaries[boundary->getChannelPosition().getChannel()->getId()];
+        T position = boundary->getChannelPosition().getPosition();
+        auto next = std::upper_bound(boundaries.begin(), boundaries.end(), position, [](T position, const auto& other) {
+            return position < other.first->getChannelPosition().getPosition();
+        });
+        boundaries.emplace(next, boundary, droplet);
+    }
+
+    template<typename T>
+    void Simulation<T>::removeChannelBoundary(int channelId, DropletBoundary<T>* boundary) {
+        auto boundaries = channelBoundaries.find(channelId);
+        if (boundaries == channelBoundaries.end()) {
+            return;
+        }
+        // only the address is compared, the boundary may already be destroyed
+        auto entry = std::find_if(boundaries->second.begin(), boundaries->second.end(), [&](const auto& other) { return other.first == boundary; });
+        if (entry != boundaries->second.end()) {
+            boundaries->second.erase(entry);
+        }
     }
 
     template<typename T>
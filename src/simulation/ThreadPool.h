@@ -0,0 +1,75 @@
+/**
+ * @file ThreadPool.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+/**
+ * @brief Class to define a fixed pool of worker threads that execute a set of independent tasks, e.g., the solve steps of the CFD simulators.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;               ///< Worker threads of the pool.
+    std::mutex mutex;                               ///< Protects the state of the current batch of tasks.
+    std::condition_variable taskAvailable;          ///< Signals the workers that a new batch of tasks was submitted.
+    std::condition_variable batchFinished;          ///< Signals the caller that all tasks of the batch are finished.
+    const std::function<void(int)>* task = nullptr; ///< Task of the current batch, called with the task index.
+    int nTasks = 0;                                 ///< Number of tasks in the current batch.
+    int nextTask = 0;                               ///< Index of the next task that is not yet started.
+    int pendingTasks = 0;                           ///< Number of tasks of the current batch that are not yet finished.
+    unsigned long batch = 0;                        ///< Counter of submitted batches.
+    bool stopping = false;                          ///< Is the pool being destroyed?
+    std::exception_ptr exception;                   ///< First exception thrown by a task of the current batch.
+
+    /**
+     * @brief Loop of a worker thread, that executes tasks of the submitted batches until the pool is destroyed.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Execute tasks of the current batch until no task is left. Requires a lock on the mutex.
+     * @param[in, out] lock Lock on the mutex of the pool, which is released while a task is executed.
+     */
+    void executeTasks(std::unique_lock<std::mutex>& lock);
+
+public:
+    /**
+     * @brief Constructor of the thread pool.
+     * @param[in] nThreads Number of threads that execute tasks, including the calling thread. 0 uses all hardware threads.
+     */
+    explicit ThreadPool(unsigned int nThreads);
+
+    /**
+     * @brief Destructor of the thread pool, that joins all worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Execute task(i) for all i in [0, nTasks) on the pool. The calling thread takes part in the execution.
+     * Returns only once all tasks are finished, i.e., the call acts as a barrier. The first exception thrown by a task is rethrown.
+     * @param[in] nTasks Number of tasks.
+     * @param[in] task Task that is called with the task index.
+     */
+    void run(int nTasks, const std::function<void(int)>& task);
+
+    /**
+     * @brief Get the number of threads that execute tasks, including the calling thread.
+     * @returns Number of threads.
+     */
+    unsigned int getThreads() const;
+};
+
+}   // namespace sim
@@ -0,0 +1,93 @@
+#include "ThreadPool.h"
+
+namespace sim {
+
+inline ThreadPool::ThreadPool(unsigned int nThreads) {
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // the calling thread executes tasks as well
+    for (unsigned int i = 1; i < nThreads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+inline void ThreadPool::workerLoop() {
+    unsigned long lastBatch = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        taskAvailable.wait(lock, [&]() { return stopping || batch != lastBatch; });
+        if (stopping) {
+            return;
+        }
+        lastBatch = batch;
+        executeTasks(lock);
+    }
+}
+
+inline void ThreadPool::executeTasks(std::unique_lock<std::mutex>& lock) {
+    while (task != nullptr && nextTask < nTasks) {
+        const int index = nextTask++;
+        const auto& currentTask = *task;
+        lock.unlock();
+        std::exception_ptr taskException;
+        try {
+            currentTask(index);
+        } catch (...) {
+            taskException = std::current_exception();
+        }
+        lock.lock();
+        if (taskException && !exception) {
+            exception = taskException;
+        }
+        if (--pendingTasks == 0) {
+            batchFinished.notify_all();
+        }
+    }
+}
+
+inline void ThreadPool::run(int nTasks_, const std::function<void(int)>& task_) {
+    if (workers.empty() || nTasks_ <= 1) {
+        for (int i = 0; i < nTasks_; ++i) {
+            task_(i);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    task = &task_;
+    nTasks = nTasks_;
+    nextTask = 0;
+    pendingTasks = nTasks_;
+    exception = nullptr;
+    batch++;
+    taskAvailable.notify_all();
+
+    // take part in the execution and wait for the remaining tasks (barrier)
+    executeTasks(lock);
+    batchFinished.wait(lock, [&]() { return pendingTasks == 0; });
+    task = nullptr;
+
+    if (exception) {
+        std::exception_ptr taskException = exception;
+        exception = nullptr;
+        std::rethrow_exception(taskException);
+    }
+}
+
+inline unsigned int ThreadPool::getThreads() const {
+    return workers.size() + 1;
+}
+
+}   // namespace sim
@@ -0,0 +1,152 @@
+/**
+ * @file EventScheduler.h
+ */
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../MemoryPool.h"
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Event;
+
+/**
+ * @brief Enum to specify the source of a group of scheduled events.
+ */
+enum class EventSource {
+    Injection,      ///< Injection event of a droplet injection.
+    Droplet,        ///< Boundary and merge bifurcation events of a droplet.
+    Channel,        ///< Merge channel events of the boundaries inside a channel.
+    TimeStep        ///< Time step event of the adaptive time stepping.
+};
+
+/**
+ * @brief Class that keeps the events of a simulation in a priority queue ordered by (time, priority) across iterations.
+ * Events are scheduled in groups, e.g., all events of one droplet. Invalidating a group removes its events lazily from
+ * the queue, such that only the events of the invalidated groups have to be recomputed after an event.
+ */
+template<typename T>
+class EventScheduler {
+private:
+    using GroupKey = std::pair<EventSource, int>;
+
+    /**
+     * @brief An entry of the priority queue.
+     */
+    struct Entry {
+        T time;                     ///< Absolute time of the event in s.
+        int priority;               ///< Priority of the event.
+        long sequence;              ///< Order in which the events were scheduled, breaks ties of time and priority.
+        GroupKey group;             ///< Group of the event.
+        unsigned long version;      ///< Version of the group at the time the event was scheduled.
+        Event<T>* event;            ///< The event, which is owned by its group.
+    };
+
+    /**
+     * @brief A group of events that is invalidated together.
+     */
+    struct Group {
+        std::vector<PoolPtr<Event<T>>> events;          ///< Scheduled events of the group.
+        std::vector<T> scheduledAt;                     ///< Simulation time at which each event was scheduled in s.
+        unsigned long version = 0;                      ///< Incremented on invalidation, outdates the entries in the queue.
+    };
+
+    std::shared_ptr<MemoryPool> pool;       ///< Pool in which the events are allocated, if any.
+    std::map<GroupKey, Group> groups;       ///< Groups of scheduled events.
+    std::vector<Entry> queue;               ///< Binary heap of the scheduled events, may contain outdated entries.
+    long sequence = 0;                      ///< Sequence number of the next scheduled event.
+    size_t nEvents = 0;                     ///< Number of valid events in the queue.
+
+    /**
+     * @brief Comparator of the binary heap, such that the earliest event with the highest priority is on top.
+     */
+    static bool later(const Entry& a, const Entry& b);
+
+    /**
+     * @brief Whether the entry belongs to a valid event.
+     */
+    bool isValid(const Entry& entry) const;
+
+    /**
+     * @brief Rebuild the queue from the valid entries, when the outdated entries dominate.
+     */
+    void compact();
+
+    /**
+     * @brief Add an event to its group and to the queue.
+     */
+    void push(EventSource source, int id, PoolPtr<Event<T>> event, T now);
+
+public:
+    /**
+     * @brief Set the pool in which the events are allocated. Removes all scheduled events.
+     * @param[in] pool Pool of the events. Without a pool, the events are allocated on the heap.
+     */
+    void setMemoryPool(std::shared_ptr<MemoryPool> pool);
+
+    /**
+     * @brief Construct and schedule an event. The event is allocated in the pool of the scheduler and its memory is
+     * reused once the event is invalidated.
+     * @tparam EventType Type of the event.
+     * @param[in] source Source of the group of the event.
+     * @param[in] id Id of the group of the event, e.g., the droplet id.
+     * @param[in] now Current simulation time in s.
+     * @param[in] args Arguments of the constructor of the event, with the time relative to the current simulation time.
+     */
+    template<typename EventType, typename... Args>
+    void schedule(EventSource source, int id, T now, Args&&... args);
+
+    /**
+     * @brief Remove all events of a group.
+     * @param[in] source Source of the group.
+     * @param[in] id Id of the group.
+     */
+    void invalidate(EventSource source, int id);
+
+    /**
+     * @brief Whether a group has scheduled events.
+     * @param[in] source Source of the group.
+     * @param[in] id Id of the group.
+     * @returns Whether the group has scheduled events.
+     */
+    bool isScheduled(EventSource source, int id) const;
+
+    /**
+     * @brief Get the next event, i.e., the earliest event with the highest priority. The event remains scheduled.
+     * @param[in] now Current simulation time in s.
+     * @param[out] timeStep Time until the event takes place in s.
+     * @returns Pointer to the next event or nullptr, if no events are scheduled.
+     */
+    Event<T>* next(T now, T& timeStep);
+
+    /**
+     * @brief Remove all events of the group of the next event, e.g., after it was performed.
+     */
+    void invalidateNext();
+
+    /**
+     * @brief Get the number of scheduled events.
+     * @returns Number of scheduled events.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the number of entries of the queue, including the outdated entries of invalidated groups.
+     * @returns Number of entries of the queue.
+     */
+    size_t getQueueSize() const;
+
+    /**
+     * @brief Remove all scheduled events.
+     */
+    void clear();
+};
+
+}  // namespace sim
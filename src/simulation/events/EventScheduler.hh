@@ -0,0 +1,120 @@
+#include "EventScheduler.h"
+
+namespace sim {
+
+template<typename T>
+bool EventScheduler<T>::later(const Entry& a, const Entry& b) {
+    if (a.time != b.time) {
+        return a.time > b.time;
+    }
+    if (a.priority != b.priority) {
+        return a.priority > b.priority;  // the lower the priority value, the higher the priority
+    }
+    return a.sequence > b.sequence;
+}
+
+template<typename T>
+bool EventScheduler<T>::isValid(const Entry& entry) const {
+    auto group = groups.find(entry.group);
+    return group != groups.end() && group->second.version == entry.version;
+}
+
+template<typename T>
+void EventScheduler<T>::compact() {
+    queue.erase(std::remove_if(queue.begin(), queue.end(), [&](const Entry& entry) { return !isValid(entry); }), queue.end());
+    std::make_heap(queue.begin(), queue.end(), later);
+}
+
+template<typename T>
+void EventScheduler<T>::setMemoryPool(std::shared_ptr<MemoryPool> pool) {
+    clear();
+    this->pool = std::move(pool);
+}
+
+template<typename T>
+template<typename EventType, typename... Args>
+void EventScheduler<T>::schedule(EventSource source, int id, T now, Args&&... args) {
+    push(source, id, makePooled<Event<T>, EventType>(pool.get(), std::forward<Args>(args)...), now);
+}
+
+template<typename T>
+void EventScheduler<T>::push(EventSource source, int id, PoolPtr<Event<T>> event, T now) {
+    GroupKey key(source, id);
+    Group& group = groups[key];
+    queue.push_back({ now + event->getTime(), static_cast<int>(event->getPriority()), sequence++, key, group.version, event.get() });
+    std::push_heap(queue.begin(), queue.end(), later);
+    group.events.push_back(std::move(event));
+    group.scheduledAt.push_back(now);
+    nEvents++;
+}
+
+template<typename T>
+void EventScheduler<T>::invalidate(EventSource source, int id) {
+    auto group = groups.find(GroupKey(source, id));
+    if (group == groups.end() || group->second.events.empty()) {
+        return;
+    }
+    nEvents -= group->second.events.size();
+    group->second.events.clear();
+    group->second.scheduledAt.clear();
+    group->second.version++;
+
+    if (queue.size() > 2 * nEvents + 64) {
+        compact();
+    }
+}
+
+template<typename T>
+bool EventScheduler<T>::isScheduled(EventSource source, int id) const {
+    auto group = groups.find(GroupKey(source, id));
+    return group != groups.end() && !group->second.events.empty();
+}
+
+template<typename T>
+Event<T>* EventScheduler<T>::next(T now, T& timeStep) {
+    while (!queue.empty() && !isValid(queue.front())) {
+        std::pop_heap(queue.begin(), queue.end(), later);
+        queue.pop_back();
+    }
+    if (queue.empty()) {
+        return nullptr;
+    }
+
+    const Entry& entry = queue.front();
+    const Group& group = groups.at(entry.group);
+    for (size_t i = 0; i < group.events.size(); ++i) {
+        if (group.events[i].get() == entry.event) {
+            // events that were scheduled at this time keep their exact relative time
+            timeStep = (group.scheduledAt[i] == now) ? entry.event->getTime() : entry.time - now;
+            break;
+        }
+    }
+    return entry.event;
+}
+
+template<typename T>
+void EventScheduler<T>::invalidateNext() {
+    if (!queue.empty() && isValid(queue.front())) {
+        GroupKey key = queue.front().group;
+        invalidate(key.first, key.second);
+    }
+}
+
+template<typename T>
+size_t EventScheduler<T>::size() const {
+    return nEvents;
+}
+
+template<typename T>
+size_t EventScheduler<T>::getQueueSize() const {
+    return queue.size();
+}
+
+template<typename T>
+void EventScheduler<T>::clear() {
+    groups.clear();
+    queue.clear();
+    nEvents = 0;
+}
+
+}  // namespace sim
@@ -31,6 +31,9 @@ class Scheme;
 
 namespace sim {
 
+// Forward declared dependencies
+class ThreadPool;
+
 /**
  * @brief Class to specify a module, which is a functional component in a network.
 */
@@ -138,6 +141,12 @@ public:
      */
     void setUpdateScheme(const std::shared_ptr<mmft::Scheme<T>>& updateScheme);
 
+    /**
+     * @brief Get the update scheme for Abstract-CFD coupling of this simulator.
+     * @returns updateScheme.
+     */
+    const std::shared_ptr<mmft::Scheme<T>>& getUpdateScheme() const;
+
     /**
      * @brief Set the path, where vtk output from the simulator should be stored.
      * @param[in] vtkFolder A string containing the path to the vtk folder.
@@ -268,6 +277,11 @@ public:
     {
         throw std::runtime_error("The function writeVTK is undefined for this CFD simulator.");
     }
+
+    /**
+     * @brief Wait until the vtk output of the CFD simulation that is written in the background is on the file system.
+    */
+    virtual void flushVTK () { }
     
     /**
      * @brief Write the .ppm image file with the pressure results of the CFD simulation to file system.
@@ -324,7 +338,7 @@ public:
     */
     virtual bool hasAdConverged() const { return false; }
 
-    friend void coupleNsAdLattices<T>(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators);
+    friend void coupleNsAdLattices<T>(const std::unordered_map<int, std::unique_ptr<CFDSimulator<T>>>& cfdSimulators, ThreadPool* threadPool);
 
 };
 
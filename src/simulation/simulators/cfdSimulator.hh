@@ -61,6 +61,11 @@ void CFDSimulator<T>::setUpdateScheme(const std::shared_ptr<mmft::Scheme<T>>& up
     this->updateScheme = updateScheme_;
 }
 
+template <typename T>
+const std::shared_ptr<mmft::Scheme<T>>& CFDSimulator<T>::getUpdateScheme() const {
+    return this->updateScheme;
+}
+
 template<typename T>
 void CFDSimulator<T>::setVtkFolder(std::string vtkFolder_) {
     this->vtkFolder = vtkFolder_;
@@ -8,6 +8,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <utility>
 #include <memory>
 #include <math.h>
 #include <iostream>
@@ -60,6 +61,10 @@ protected:
     T resolution;                           ///< Resolution of the CFD domain. Gridpoints in charPhysLength.
     T epsilon;                              ///< Convergence criterion.
     T relaxationTime;                       ///< Relaxation time (tau) for the OLB solver.
+    T residualTolerance = 0.0;              ///< Relative change of the opening values below which solve() returns early (0 disables the early exit).
+    int residualInterval = 5;               ///< Number of iterations between two evaluations of the opening residual.
+    std::unordered_map<int, T> openingValues;       ///< Values at the openings of the latest residual evaluation. <nodeId, value>
+    std::unordered_map<int, T> lastOpeningValues;   ///< Values at the openings of the previous residual evaluation. <nodeId, value>
 
     std::shared_ptr<olb::STLreader<T>> stlReader;
     std::shared_ptr<olb::IndicatorF2DfromIndicatorF3D<T>> stl2Dindicator;
@@ -75,6 +80,18 @@ protected:
     std::unordered_map<int, std::shared_ptr<olb::SuperPlaneIntegralFluxVelocity2D<T>>> fluxes;              ///< Map of fluxes at module nodes. 
     std::unordered_map<int, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>>> meanPressures;       ///< Map of mean pressure values at module nodes.
 
+    /**
+     * @brief Fields of the lattice at one vtk output, which are written in the background.
+     */
+    struct VtkSnapshot {
+        std::vector<std::unique_ptr<olb::SuperData<2,T,T>>> fields;    ///< Values of the fields.
+        std::vector<std::string> names;                                 ///< Names of the fields.
+    };
+
+    int vtkInterval = 1000;                 ///< Number of iterations between two vtk outputs.
+    std::unique_ptr<BufferPool<VtkSnapshot>> vtkSnapshots;  ///< Snapshots that are reused once the background writer released them.
+    std::unique_ptr<AsyncWriter> vtkWriter; ///< Background writer of the vtk snapshots. Declared last, such that it is joined before the geometry is destroyed.
+
     auto& getConverter() {
         return *converter;
     }
@@ -107,6 +124,32 @@ protected:
 
     void setPressure2D(int key);
 
+    /**
+     * @brief Feed the convergence tracker of the lattice. Independent of the vtk output, this is called every iteration.
+     * @param[in] iT Iteration step.
+    */
+    virtual void trackConvergence(int iT);
+
+    /**
+     * @brief Overwrite the values of a field of a reused vtk snapshot, without allocating its memory again.
+     * @param[in] field Field of the lattice.
+     * @param[out] data Values of the field, allocated for the same lattice.
+    */
+    void copyField(olb::SuperF2D<T,T>& field, olb::SuperData<2,T,T>& data);
+
+    /**
+     * @brief Evaluate the CFD results at the openings, i.e., the pressure at ground nodes and the flow rate otherwise.
+     * @param[out] values Values at the openings. <nodeId, value>
+    */
+    void evaluateOpenings(std::unordered_map<int, T>& values);
+
+    /**
+     * @brief Evaluate the CFD results at the openings and compute their largest relative change since the last evaluation.
+     * The values are kept in buffers of the simulator, the pressures and flow rates of the module nodes are not changed.
+     * @returns The relative residual of the pressures and flow rates at the openings.
+    */
+    T computeOpeningResidual();
+
     /**
      * @brief Update the values at the module nodes based on the simulation result after stepIter iterations.
      * @param[in] iT Iteration step.
@@ -186,6 +229,26 @@ public:
     */
     void writeVTK(int iT) override;
 
+    /**
+     * @brief Set the residual criterion that ends the collide and stream iterations of solve() before theta is reached.
+     * The criterion is not evaluated by the mixing simulator, whose solve() conducts a fixed number of iterations.
+     * @param[in] tolerance Relative change of the pressures and flow rates at the openings below which solve() returns (0 disables the early exit).
+     * @param[in] interval Number of iterations between two evaluations of the residual.
+    */
+    void setResidualTolerance(T tolerance, int interval);
+
+    /**
+     * @brief Set the cadence of the vtk output and whether the vtk files are written in the background.
+     * @param[in] interval Number of iterations between two vtk outputs.
+     * @param[in] maxQueued Maximal number of field snapshots in flight to the background writer (0 writes the vtk files synchronously).
+    */
+    void setVtkOutput(int interval, int maxQueued);
+
+    /**
+     * @brief Wait until all field snapshots are written to the file system.
+    */
+    void flushVTK() override;
+
     /**
      * @brief Write the .ppm image file with the pressure results of the CFD simulation to file system.
      * @param[in] min Minimal bound for colormap.
@@ -85,35 +85,68 @@ void lbmSimulator<T>::setBoundaryValues (int iT) {
 template<typename T>
 void lbmSimulator<T>::writeVTK (int iT) {
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    if (iT != 0 && iT % vtkInterval != 0) {
+        return;
+    }
 
-    olb::SuperVTMwriter2D<T> vtmWriter( this->name );
     // Writes geometry to file system
     if (iT == 0) {
+        // The VTK output accesses the OpenLB singletons, which are shared with concurrently solved simulators
+        std::lock_guard<std::mutex> singletonLock(getOlbSingletonMutex());
+        olb::SuperVTMwriter2D<T> vtmWriter( this->name );
         olb::SuperLatticeGeometry2D<T,DESCRIPTOR> writeGeometry (getLattice(), getGeometry());
         vtmWriter.write(writeGeometry);
         vtmWriter.createMasterFile();
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + olb::createFileName( this->name ) + ".pvd";
     }
 
-    if (iT % 1000 == 0) {
+    if (iT % vtkInterval == 0) {
         
         olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(getLattice(), getConverter());
         olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(getLattice(), getConverter());
         olb::SuperLatticeDensity2D<T,DESCRIPTOR> latDensity(getLattice());
-        vtmWriter.addFunctor(velocity);
-        vtmWriter.addFunctor(pressure);
-        vtmWriter.addFunctor(latDensity);
-        
-        // write vtk to file system
-        vtmWriter.write(iT);
+
+        if (vtkWriter == nullptr) {
+            std::lock_guard<std::mutex> singletonLock(getOlbSingletonMutex());
+            olb::SuperVTMwriter2D<T> vtmWriter( this->name );
+            vtmWriter.addFunctor(velocity);
+            vtmWriter.addFunctor(pressure);
+            vtmWriter.addFunctor(latDensity);
+            
+            // write vtk to file system
+            vtmWriter.write(iT);
+        } else {
+            // Snapshot the fields, such that the lattice is stepped on while the snapshot is written in the background.
+            // A snapshot that was already written is overwritten, otherwise its fields are allocated.
+            std::shared_ptr<VtkSnapshot> snapshot = vtkSnapshots->acquire();
+            std::vector<olb::SuperF2D<T,T>*> fields {&velocity, &pressure, &latDensity};
+            if (snapshot->fields.size() == fields.size()) {
+                for (std::size_t i = 0; i < fields.size(); ++i) {
+                    copyField(*fields[i], *snapshot->fields[i]);
+                }
+            } else {
+                snapshot->fields.clear();
+                snapshot->names.clear();
+                for (olb::SuperF2D<T,T>* field : fields) {
+                    snapshot->fields.push_back(std::make_unique<olb::SuperData<2,T,T>>(*field));
+                    snapshot->names.push_back(field->getName());
+                }
+            }
+            std::string name = this->name;
+            vtkWriter->push([snapshot, name, iT]() {
+                std::lock_guard<std::mutex> singletonLock(getOlbSingletonMutex());
+                olb::SuperVTMwriter2D<T> vtmWriter( name );
+                std::vector<std::unique_ptr<olb::SuperDataF2D<T,T>>> fields;
+                for (std::size_t i = 0; i < snapshot->fields.size(); ++i) {
+                    fields.push_back(std::make_unique<olb::SuperDataF2D<T,T>>(*snapshot->fields[i]));
+                    fields.back()->getName() = snapshot->names[i];
+                    vtmWriter.addFunctor(*fields.back());
+                }
+                vtmWriter.write(iT);
+            });
+        }
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + "data/" + olb::createFileName( this->name, iT ) + ".vtm";
-        converge->takeValue(getLattice().getStatistics().getAverageEnergy(), print);
-    }
-    if (iT %1000 == 0) {
+
         #ifdef VERBOSE
             std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
             for (auto& [key, Opening] : this->moduleOpenings) {
@@ -125,6 +158,58 @@ void lbmSimulator<T>::writeVTK (int iT) {
             } 
         #endif
     }
+}
+
+template<typename T>
+void lbmSimulator<T>::setVtkOutput (int interval_, int maxQueued_) {
+    if (interval_ < 1 || maxQueued_ < 0) {
+        throw std::invalid_argument("The vtk interval must be positive and the number of queued snapshots non-negative.");
+    }
+    flushVTK();
+    vtkInterval = interval_;
+    if (maxQueued_ > 0) {
+        // the queued snapshots and the one that is filled
+        vtkSnapshots = std::make_unique<BufferPool<VtkSnapshot>>(maxQueued_ + 1);
+        vtkWriter = std::make_unique<AsyncWriter>(maxQueued_);
+    } else {
+        vtkWriter = nullptr;
+        vtkSnapshots = nullptr;
+    }
+}
+
+template<typename T>
+void lbmSimulator<T>::copyField (olb::SuperF2D<T,T>& field, olb::SuperData<2,T,T>& data) {
+    // same traversal as the construction of olb::SuperData from a functor
+    std::vector<T> values(field.getTargetDim());
+    int input[3];
+    for (int iC = 0; iC < data.getLoadBalancer().size(); ++iC) {
+        input[0] = data.getLoadBalancer().glob(iC);
+        auto& block = data.get(iC);
+        for (input[1] = 0; input[1] < block.getNx(); ++input[1]) {
+            for (input[2] = 0; input[2] < block.getNy(); ++input[2]) {
+                field(values.data(), input);
+                for (int iDim = 0; iDim < field.getTargetDim(); ++iDim) {
+                    block.get(input[1], input[2], iDim) = values[iDim];
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void lbmSimulator<T>::flushVTK () {
+    if (vtkWriter != nullptr) {
+        vtkWriter->flush();
+    }
+}
+
+template<typename T>
+void lbmSimulator<T>::trackConvergence (int iT) {
+
+    bool print = false;
+    #ifdef VERBOSE
+        print = true;
+    #endif
 
     converge->takeValue(getLattice().getStatistics().getAverageEnergy(), print);
 
@@ -133,7 +218,48 @@ void lbmSimulator<T>::writeVTK (int iT) {
             isConverged = true;
         }
     }
+}
+
+template<typename T>
+void lbmSimulator<T>::evaluateOpenings (std::unordered_map<int, T>& values) {
+    int input[1] = { };
+    T output[10];
 
+    for (auto& [key, Opening] : this->moduleOpenings) {
+        if (this->groundNodes.at(key)) {
+            meanPressures.at(key)->operator()(output, input);
+            values[key] = output[0]/output[1];
+        } else {
+            fluxes.at(key)->operator()(output, input);
+            values[key] = output[0];
+        }
+    }
+}
+
+template<typename T>
+T lbmSimulator<T>::computeOpeningResidual () {
+    evaluateOpenings(openingValues);
+
+    T residual = 0.0;
+    for (auto& [key, newValue] : openingValues) {
+        T oldValue = lastOpeningValues.at(key);
+        T scale = std::max(std::abs(oldValue), std::abs(newValue));
+        if (scale > 0.0) {
+            residual = std::max(residual, std::abs(newValue - oldValue) / scale);
+        }
+    }
+    // The latest evaluation is the reference of the next one
+    std::swap(openingValues, lastOpeningValues);
+    return residual;
+}
+
+template<typename T>
+void lbmSimulator<T>::setResidualTolerance (T tolerance_, int interval_) {
+    if (tolerance_ < 0.0 || interval_ < 1) {
+        throw std::invalid_argument("The residual tolerance must be non-negative and the residual interval positive.");
+    }
+    residualTolerance = tolerance_;
+    residualInterval = interval_;
 }
 
 template<typename T>
@@ -161,10 +287,23 @@ template<typename T>
 void lbmSimulator<T>::solve() {
     int theta = this->updateScheme->getTheta(this->cfdModule->getId());
     this->setBoundaryValues(step);
+    if (residualTolerance > 0.0) {
+        // The results of the previous solve are the reference of the first residual
+        for (auto& [key, Opening] : this->moduleOpenings) {
+            lastOpeningValues[key] = this->groundNodes.at(key) ? pressures.at(key) : flowRates.at(key);
+        }
+    }
     for (int iT = 0; iT < theta; ++iT){    
         writeVTK(step);       
+        trackConvergence(step);
         lattice->collideAndStream();
         step += 1;
+        // End early if the results at the openings no longer change, the results are only stored after the loop
+        if (residualTolerance > 0.0 && (iT + 1) % residualInterval == 0 && iT + 1 < theta) {
+            if (computeOpeningResidual() < residualTolerance) {
+                break;
+            }
+        }
     }
     storeCfdResults(step);
 }
@@ -420,17 +559,13 @@ void lbmSimulator<T>::setPressure2D (int openingKey)  {
 
 template<typename T>
 void lbmSimulator<T>::storeCfdResults (int iT) {
-    int input[1] = { };
-    T output[10];
-    
-    for (auto& [key, Opening] : this->moduleOpenings) {
+    evaluateOpenings(openingValues);
+
+    for (auto& [key, value] : openingValues) {
         if (this->groundNodes.at(key)) {
-            meanPressures.at(key)->operator()(output, input);
-            T newPressure =  output[0]/output[1];
-            pressures.at(key) = newPressure;
+            pressures.at(key) = value;
         } else {
-            fluxes.at(key)->operator()(output,input);
-            flowRates.at(key) = output[0];
+            flowRates.at(key) = value;
         }
     }
 }
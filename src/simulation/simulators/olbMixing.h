@@ -28,6 +28,9 @@ class Opening;
 
 namespace sim {
 
+// Forward declared dependencies
+class ThreadPool;
+
 /**
  * @brief Class that defines the lbm module which is the interface between the 1D solver and OLB.
 */
@@ -60,6 +63,8 @@ protected:
     std::unordered_map<int, T*> fluxWall;
     T zeroFlux = 0.0;
 
+    std::unique_ptr<ThreadPool> adThreadPool = nullptr;     ///< Thread pool that steps the AD lattices of the species concurrently.
+
     std::unordered_map<int, std::unordered_map<int, std::shared_ptr<olb::AnalyticalConst2D<T,T>>>> concentrationProfiles;
     std::unordered_map<int, std::unordered_map<int, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>>>> meanConcentrations;       ///< Map of mean pressure values at module nodes.
 
@@ -93,6 +98,12 @@ protected:
     */
     void executeCoupling() override;
 
+    /**
+     * @brief Conduct one collide and stream operation on the AD lattices of all species.
+     * The AD lattices only read the velocity field that is coupled from the NS lattice, hence they are stepped concurrently if an AD thread pool is set.
+    */
+    void adCollideAndStream();
+
     void setConcentration2D(int key);
 
     /**
@@ -175,12 +186,24 @@ public:
     */
     void adSolve() override;
 
+    /**
+     * @brief Set the number of threads that step the AD lattices of the species concurrently.
+     * @param[in] nThreads Number of threads (1 steps the lattices sequentially, 0 uses all hardware threads).
+    */
+    void setAdThreads(int nThreads);
+
     /**
      * @brief Write the vtk file with results of the CFD simulation to file system.
      * @param[in] iT Iteration step.
     */
     void writeVTK(int iT) override;
 
+    /**
+     * @brief Feed the convergence trackers of the NS lattice and of the AD lattices of all species.
+     * @param[in] iT Iteration step.
+    */
+    void trackConvergence(int iT) override;
+
     /**
      * @brief Store the abstract concentrations at the nodes on the module boundary in the simulator.
      * @param[in] concentrations Map of concentrations and node ids.
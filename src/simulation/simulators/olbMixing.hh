@@ -130,10 +130,12 @@ void lbmMixingSimulator<T>::storeCfdResults (int iT) {
 template<typename T>
 void lbmMixingSimulator<T>::writeVTK (int iT) {
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    if (iT != 0 && iT % this->vtkInterval != 0) {
+        return;
+    }
+
+    // The VTK output accesses the OpenLB singletons, which are shared with concurrently solved simulators
+    std::lock_guard<std::mutex> singletonLock(getOlbSingletonMutex());
 
     olb::SuperVTMwriter2D<T> vtmWriter( this->name );
     // Writes geometry to file system
@@ -144,7 +146,7 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + olb::createFileName( this->name ) + ".pvd";
     }
 
-    if (iT % 1000 == 0) {
+    if (iT % this->vtkInterval == 0) {
         
         olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(this->getLattice(), this->getConverter());
         olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(this->getLattice(), this->getConverter());
@@ -164,30 +166,27 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
 
         // write vtk to file system
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + "data/" + olb::createFileName( this->name, iT ) + ".vtm";
-        this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), !print);
-        for (auto& [key, adConverge] : adConverges) {
-            //adConverge->takeValue(getAdLattice(key).getStatistics().getAverageRho(), print);
-            T newRho = getAdLattice(key).getStatistics().getAverageRho();
-            if (std::abs(averageDensities.at(key) - newRho) < 1e-5) {
-                custConverges.at(key) = true;
-            }
-            averageDensities.at(key) = newRho;
-        }
-    }
-    if (iT %1000 == 0) {
+
         #ifdef VERBOSE
             std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
         #endif
     }
+}
 
-    this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
+template<typename T>
+void lbmMixingSimulator<T>::trackConvergence (int iT) {
+
+    lbmSimulator<T>::trackConvergence(iT);
 
-    if (iT%100 == 0) {
-        if (this->converge->hasConverged()) {
-                this->isConverged = true;
+    if (iT % 1000 == 0) {
+        for (auto& [key, adConverge] : adConverges) {
+            T newRho = getAdLattice(key).getStatistics().getAverageRho();
+            if (std::abs(averageDensities.at(key) - newRho) < 1e-5) {
+                custConverges.at(key) = true;
+            }
+            averageDensities.at(key) = newRho;
         }
     }
-
 }
 
 template<typename T>
@@ -197,10 +196,9 @@ void lbmMixingSimulator<T>::solve() {
     for (int iT = 0; iT < 10; ++iT){
         this->lattice->collideAndStream();
         this->lattice->executeCoupling();
-        for (auto& [speciesId, adLattice] : adLattices) {
-            adLattice->collideAndStream();
-        }
+        adCollideAndStream();
         writeVTK(this->step);
+        trackConvergence(this->step);
         this->step += 1;
     }
     storeCfdResults(this->step);
@@ -220,6 +218,7 @@ void lbmMixingSimulator<T>::nsSolve() {
     for (int iT = 0; iT < 10; ++iT){
         this->lattice->collideAndStream();
         writeVTK(this->step);
+        trackConvergence(this->step);
         this->step += 1;
     }
     storeCfdResults(this->step);
@@ -230,15 +229,45 @@ void lbmMixingSimulator<T>::adSolve() {
     // theta = 10
     this->setBoundaryValues(this->step);
     for (int iT = 0; iT < 100; ++iT){
-        for (auto& [speciesId, adLattice] : adLattices) {
-            adLattice->collideAndStream();
-        }
+        adCollideAndStream();
         writeVTK(this->step);
+        trackConvergence(this->step);
         this->step += 1;
     }
     storeCfdResults(this->step);
 }
 
+template<typename T>
+void lbmMixingSimulator<T>::adCollideAndStream() {
+    if (adThreadPool == nullptr || adLattices.size() <= 1) {
+        for (auto& [speciesId, adLattice] : adLattices) {
+            adLattice->collideAndStream();
+        }
+        return;
+    }
+
+    std::vector<olb::SuperLattice<T, ADDESCRIPTOR>*> lattices;
+    lattices.reserve(adLattices.size());
+    for (auto& [speciesId, adLattice] : adLattices) {
+        lattices.push_back(adLattice.get());
+    }
+    adThreadPool->run(lattices.size(), [&](int i) { lattices[i]->collideAndStream(); });
+}
+
+template<typename T>
+void lbmMixingSimulator<T>::setAdThreads(int nThreads) {
+    if (nThreads < 0) {
+        throw std::invalid_argument("The number of AD threads must be non-negative.");
+    }
+    unsigned int threads = (nThreads > 0) ? nThreads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<unsigned int>(threads, std::max<std::size_t>(species.size(), 1));
+    if (threads > 1) {
+        adThreadPool = std::make_unique<ThreadPool>(threads);
+    } else {
+        adThreadPool = nullptr;
+    }
+}
+
 template<typename T>
 void lbmMixingSimulator<T>::initValueContainers () {
     // Initialize pressure, flowRate and concentration value-containers
@@ -108,10 +108,12 @@ void lbmOocSimulator<T>::prepareLattice () {
 template<typename T>
 void lbmOocSimulator<T>::writeVTK (int iT) {
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    if (iT != 0 && iT % this->vtkInterval != 0) {
+        return;
+    }
+
+    // The VTK output accesses the OpenLB singletons, which are shared with concurrently solved simulators
+    std::lock_guard<std::mutex> singletonLock(getOlbSingletonMutex());
 
     olb::SuperVTMwriter2D<T> vtmWriter( this->name );
     // Writes geometry to file system
@@ -122,7 +124,7 @@ void lbmOocSimulator<T>::writeVTK (int iT) {
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + olb::createFileName( this->name ) + ".pvd";
     }
 
-    if (iT % 1000 == 0) {
+    if (iT % this->vtkInterval == 0) {
         
         olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(this->getLattice(), this->getConverter());
         olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(this->getLattice(), this->getConverter());
@@ -142,22 +144,11 @@ void lbmOocSimulator<T>::writeVTK (int iT) {
 
         // write vtk to file system
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + "data/" + olb::createFileName( this->name, iT ) + ".vtm";
-        this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
-    }
-    if (iT %1000 == 0) {
+
         #ifdef VERBOSE
             std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
         #endif
     }
-
-    this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
-
-    if (iT%100 == 0) {
-        if (this->converge->hasConverged()) {
-                this->isConverged = true;
-        }
-    }
-
 }
 
 template<typename T>
@@ -4,6 +4,37 @@
 
 using T = double;
 
+/**
+ * Generates a ladder network with nRungs rungs, whose channels have different resistances. Node 0 is the ground node of the
+ * inlet, rung i connects node 2i+1 of the upper rail with node 2i+2 of the lower rail, and the last node of the lower rail
+ * is connected to the ground node of the outlet.
+*/
+arch::Network<T> generateLadderNetwork(int nRungs) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Ladder;
+    settings.nNodes = 2 * nRungs;
+    arch::Network<T> network = porting::networkFromJSON<T>(porting::generateNetwork(settings));
+    for (auto& [channelId, channel] : network.getChannels()) {
+        channel->setResistance(1.0 + channelId % 7);
+    }
+    return network;
+}
+
+/**
+ * Gets the rungs of a generated ladder network.
+*/
+std::vector<arch::RectangularChannel<T>*> getRungs(const arch::Network<T>& network, int nRungs) {
+    std::vector<arch::RectangularChannel<T>*> rungs;
+    for (int i = 0; i < nRungs; ++i) {
+        for (auto channel : network.getChannelsAtNode(2*i + 1)) {
+            if (channel->getNodeA() == 2*i + 2 || channel->getNodeB() == 2*i + 2) {
+                rungs.push_back(channel);
+            }
+        }
+    }
+    return rungs;
+}
+
 TEST(Network, testNetwork1) {
     // define network
     arch::Network<T> network;
@@ -190,6 +221,226 @@ TEST(Network, testNetwork5) {
     EXPECT_NEAR(node3->getPressure(), -35.5, errorTolerance);
 }
 
+TEST(Network, sparseNodalAnalysis) {
+    // define ladder network
+    arch::Network<T> network = generateLadderNetwork(100);
+    auto node0 = network.getNode(0);
+    auto top0 = network.getNode(1);
+
+    // pressure pump (voltage source) and flowRate pump (current source)
+    auto v0 = network.addPressurePump(node0->getId(), top0->getId(), 100.0);
+    network.addFlowRatePump(node0->getId(), 2, 1.0);
+
+    network.sortGroups();
+
+    // compute network with the dense solver
+    nodal::NodalAnalysis<T> denseAnalysis(&network);
+    denseAnalysis.conductNodalAnalysis();
+    EXPECT_FALSE(denseAnalysis.isSparse());
+
+    std::unordered_map<int, T> densePressures;
+    for (auto& [nodeId, node] : network.getNodes()) {
+        densePressures.try_emplace(nodeId, node->getPressure());
+    }
+    T denseFlowRate = v0->getFlowRate();
+
+    // compute network with the sparse solver
+    nodal::NodalAnalysis<T> sparseAnalysis(&network);
+    sparseAnalysis.setSparseThreshold(0);
+    sparseAnalysis.conductNodalAnalysis();
+    EXPECT_TRUE(sparseAnalysis.isSparse());
+
+    // check result
+    const double errorTolerance = 1e-9;
+    for (auto& [nodeId, node] : network.getNodes()) {
+        EXPECT_NEAR(node->getPressure(), densePressures.at(nodeId), errorTolerance);
+    }
+    EXPECT_NEAR(node0->getPressure(), 0.0, errorTolerance);
+    EXPECT_NEAR(top0->getPressure(), 100.0, errorTolerance);
+    EXPECT_NEAR(v0->getFlowRate(), denseFlowRate, errorTolerance);
+
+    // change resistances and recompute with the reused symbolic factorization
+    sparseAnalysis.setFactorizationReuse(true);
+    for (int i = 0; i < 3; ++i) {
+        network.getChannel(7*i + 2)->setResistance(10.0 + i);
+        sparseAnalysis.conductNodalAnalysis();
+    }
+    std::unordered_map<int, T> reusePressures;
+    for (auto& [nodeId, node] : network.getNodes()) {
+        reusePressures.try_emplace(nodeId, node->getPressure());
+    }
+
+    denseAnalysis.conductNodalAnalysis();
+    for (auto& [nodeId, node] : network.getNodes()) {
+        EXPECT_NEAR(reusePressures.at(nodeId), node->getPressure(), errorTolerance);
+    }
+}
+
+TEST(Network, incrementalNodalAnalysis) {
+    // define ladder network
+    arch::Network<T> network = generateLadderNetwork(20);
+    std::vector<arch::RectangularChannel<T>*> rungs = getRungs(network, 20);
+    ASSERT_EQ(rungs.size(), 20u);
+
+    // pressure pump (voltage source)
+    network.addPressurePump(0, 1, 100.0);
+
+    network.sortGroups();
+
+    // the backward error is checked after every update, and after every third update
+    for (int checkInterval : { 1, 3 }) {
+        nodal::NodalAnalysis<T> incrementalAnalysis(&network);
+        incrementalAnalysis.setIncrementalUpdates(5, 16, 1e-9, checkInterval);
+        incrementalAnalysis.conductNodalAnalysis();
+
+        // change the resistance of few channels at a time, as droplets do
+        const double errorTolerance = 1e-9;
+        for (int i = 0; i < 8; ++i) {
+            rungs[i]->setResistance(10.0 + i + checkInterval);
+            rungs[19 - i]->setResistance(20.0 + i + checkInterval);
+            incrementalAnalysis.conductNodalAnalysis(std::vector<int>{ rungs[i]->getId(), rungs[19 - i]->getId() });
+
+            std::unordered_map<int, T> incrementalPressures;
+            for (auto& [nodeId, node] : network.getNodes()) {
+                incrementalPressures.try_emplace(nodeId, node->getPressure());
+            }
+
+            nodal::NodalAnalysis<T> nodalAnalysis(&network);
+            nodalAnalysis.conductNodalAnalysis();
+            for (auto& [nodeId, node] : network.getNodes()) {
+                EXPECT_NEAR(incrementalPressures.at(nodeId), node->getPressure(), errorTolerance);
+            }
+        }
+    }
+
+    nodal::NodalAnalysis<T> nodalAnalysis(&network);
+    EXPECT_THROW(nodalAnalysis.setIncrementalUpdates(5, 16, 1e-9, 0), std::invalid_argument);
+}
+
+TEST(Network, changedChannelsNodalAnalysis) {
+    // define ladder network
+    arch::Network<T> network = generateLadderNetwork(20);
+    std::vector<arch::RectangularChannel<T>*> rungs = getRungs(network, 20);
+    ASSERT_EQ(rungs.size(), 20u);
+
+    // pressure pump (voltage source)
+    auto pump = network.addPressurePump(0, 1, 100.0);
+
+    network.sortGroups();
+
+    // only the entries of the changed channels are reassembled, with the dense and the sparse backend
+    nodal::NodalAnalysis<T> denseAnalysis(&network);
+    nodal::NodalAnalysis<T> sparseAnalysis(&network);
+    sparseAnalysis.setSparseThreshold(0);
+    sparseAnalysis.setFactorizationReuse(true);
+    denseAnalysis.conductNodalAnalysis(std::vector<int>());
+    sparseAnalysis.conductNodalAnalysis(std::vector<int>());
+
+    const double errorTolerance = 1e-9;
+    for (int i = 0; i < 8; ++i) {
+        rungs[i]->setDropletResistance(10.0 + i);
+        rungs[19 - i]->setDropletResistance(20.0 + i);
+        std::vector<int> changedChannels = { rungs[i]->getId(), rungs[19 - i]->getId() };
+        if (i > 0) {
+            rungs[i - 1]->setDropletResistance(0.0);
+            changedChannels.push_back(rungs[i - 1]->getId());
+        }
+
+        for (auto* analysis : { &denseAnalysis, &sparseAnalysis }) {
+            analysis->conductNodalAnalysis(changedChannels);
+            std::unordered_map<int, T> changedPressures;
+            for (auto& [nodeId, node] : network.getNodes()) {
+                changedPressures.try_emplace(nodeId, node->getPressure());
+            }
+
+            nodal::NodalAnalysis<T> nodalAnalysis(&network);
+            nodalAnalysis.conductNodalAnalysis();
+            for (auto& [nodeId, node] : network.getNodes()) {
+                EXPECT_NEAR(changedPressures.at(nodeId), node->getPressure(), errorTolerance);
+            }
+        }
+    }
+
+    // ids that are not channels of the network are rejected
+    for (int channelId : { -1, pump->getId(), 1000 }) {
+        EXPECT_THROW(denseAnalysis.conductNodalAnalysis(std::vector<int>{ channelId }), std::invalid_argument);
+    }
+}
+
+TEST(Network, csrView) {
+    // define network
+    arch::Network<T> network;
+    auto node0 = network.addNode(0.0, 0.0, true);
+    auto node1 = network.addNode(0.0, 0.0, false);
+    auto node2 = network.addNode(0.0, 0.0, false);
+    auto node3 = network.addNode(0.0, 0.0, false);
+
+    auto c1 = network.addChannel(node0->getId(), node1->getId(), 1.0, arch::ChannelType::NORMAL);
+    auto c2 = network.addChannel(node1->getId(), node2->getId(), 2.0, arch::ChannelType::NORMAL);
+    auto c3 = network.addChannel(node1->getId(), node3->getId(), 3.0, arch::ChannelType::NORMAL);
+
+    network.freeze();
+    ASSERT_TRUE(network.isFrozen());
+
+    // check the view
+    const auto& csr = network.getCSR();
+    ASSERT_EQ(csr.nNodes(), 4);
+    ASSERT_EQ(csr.nEdges(), 3);
+    ASSERT_EQ(csr.offsets.back(), 6);
+    const int index1 = csr.nodeIndex.at(node1->getId());
+    ASSERT_EQ(csr.nodeIds.at(index1), node1->getId());
+    ASSERT_EQ(csr.offsets.at(index1 + 1) - csr.offsets.at(index1), 3);
+    for (int e = 0; e < csr.nEdges(); ++e) {
+        auto channel = network.getChannel(csr.edgeIds.at(e));
+        ASSERT_EQ(csr.channels.at(e), channel);
+        ASSERT_EQ(csr.nodeIds.at(csr.nodeA.at(e)), channel->getNodeA());
+        ASSERT_EQ(csr.nodeIds.at(csr.nodeB.at(e)), channel->getNodeB());
+    }
+    std::unordered_set<arch::RectangularChannel<T>*> channelsAtNode1;
+    for (auto channel : network.getChannelsAtNode(node1->getId())) {
+        channelsAtNode1.insert(channel);
+    }
+    ASSERT_EQ(channelsAtNode1, (std::unordered_set<arch::RectangularChannel<T>*>{c1, c2, c3}));
+
+    // changing the topology invalidates the view, which is only rebuilt explicitly
+    network.addChannel(node2->getId(), node3->getId(), 4.0, arch::ChannelType::NORMAL);
+    ASSERT_FALSE(network.isFrozen());
+    ASSERT_EQ(network.getChannelsAtNode(node2->getId()).size(), 2u);
+    ASSERT_THROW(network.getCSR(), std::runtime_error);
+    ASSERT_THROW(std::as_const(network).getAdjacentChannels(node2->getId()), std::runtime_error);
+    network.sortGroups();
+    ASSERT_TRUE(network.isFrozen());
+    ASSERT_EQ(network.getCSR().nEdges(), 4);
+    ASSERT_EQ(std::as_const(network).getAdjacentChannels(node2->getId()).size(), 2);
+}
+
+TEST(Network, parallelValidation) {
+    // define ladder network
+    arch::Network<T> network = generateLadderNetwork(50);
+    network.addPressurePump(0, 1, 100.0);
+
+    ASSERT_TRUE(network.isNetworkValid());
+    ASSERT_TRUE(network.isNetworkValid(4));
+
+    // a dangling node at the last node of the upper rail is reported in both modes
+    auto dangling = network.addNode(0.0, 0.0, false);
+    network.addChannel(99, dangling->getId(), 1e-4, 1e-4, 1e-3, arch::ChannelType::NORMAL);
+    std::string sequentialError;
+    std::string parallelError;
+    try {
+        network.isNetworkValid();
+    } catch (const std::invalid_argument& e) {
+        sequentialError = e.what();
+    }
+    try {
+        network.isNetworkValid(4);
+    } catch (const std::invalid_argument& e) {
+        parallelError = e.what();
+    }
+    ASSERT_NE(sequentialError.find(" " + std::to_string(dangling->getId()) + "."), std::string::npos);
+    ASSERT_EQ(sequentialError, parallelError);
+}
+
 TEST(Network, networkArchitectureDefinition) {
     // define network
     arch::Network<T> bionetwork;
@@ -0,0 +1,178 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+TEST(AsyncWriter, invalidQueue) {
+    EXPECT_THROW(sim::AsyncWriter(0), std::invalid_argument);
+}
+
+TEST(AsyncWriter, writeOrdering) {
+    std::vector<int> written;
+    sim::AsyncWriter writer(4);
+    ASSERT_EQ(writer.getMaxQueued(), 4u);
+
+    // the tasks are executed in submission order, while the submitting thread is throttled by the queue
+    for (int i = 0; i < 1000; ++i) {
+        writer.push([&written, i]() {
+            if (i % 100 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            written.push_back(i);
+        });
+    }
+    writer.flush();
+
+    ASSERT_EQ(written.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(written[i], i);
+    }
+}
+
+TEST(AsyncWriter, boundedQueue) {
+    std::atomic<int> started{0};
+    std::atomic<int> finished{0};
+    int maxInFlight = 0;
+    {
+        sim::AsyncWriter writer(2);
+        for (int i = 0; i < 20; ++i) {
+            writer.push([&]() {
+                started++;
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                finished++;
+            });
+            // the submitted tasks that are not finished never exceed the maximal number of tasks in flight
+            maxInFlight = std::max(maxInFlight, (i + 1) - finished.load());
+        }
+    }
+    ASSERT_LE(maxInFlight, 2);
+    ASSERT_EQ(started, 20);
+    ASSERT_EQ(finished, 20);
+}
+
+TEST(AsyncWriter, flushOnDestruction) {
+    std::vector<int> written;
+    {
+        sim::AsyncWriter writer(8);
+        for (int i = 0; i < 8; ++i) {
+            writer.push([&written, i]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                written.push_back(i);
+            });
+        }
+        // the destructor executes the remaining tasks before it joins the background thread
+    }
+    ASSERT_EQ(written, std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+}
+
+TEST(AsyncWriter, exceptionPropagation) {
+    std::vector<int> written;
+    sim::AsyncWriter writer(4);
+
+    // the first task blocks the writer until all tasks are submitted
+    std::promise<void> submitted;
+    std::shared_future<void> allSubmitted = submitted.get_future().share();
+    writer.push([&written, allSubmitted]() {
+        allSubmitted.wait();
+        written.push_back(0);
+    });
+    writer.push([]() { throw std::runtime_error("first"); });
+    writer.push([]() { throw std::runtime_error("second"); });
+    writer.push([&]() { written.push_back(3); });
+    submitted.set_value();
+
+    // the first exception is rethrown once, the tasks after the failed ones are still executed
+    try {
+        writer.flush();
+        FAIL() << "flush() did not rethrow the exception of the task.";
+    } catch (const std::runtime_error& e) {
+        ASSERT_STREQ(e.what(), "first");
+    }
+    ASSERT_EQ(written, std::vector<int>({ 0, 3 }));
+    ASSERT_NO_THROW(writer.flush());
+
+    // an exception of a previous task is rethrown on the next submission, which is discarded
+    writer.push([]() { throw std::runtime_error("third"); });
+    std::size_t nPushed = 0;
+    bool rethrown = false;
+    while (!rethrown) {
+        try {
+            writer.push([&]() { written.push_back(5); });
+            nPushed++;
+        } catch (const std::runtime_error& e) {
+            ASSERT_STREQ(e.what(), "third");
+            rethrown = true;
+        }
+    }
+    writer.flush();
+    ASSERT_EQ(written.size(), 2 + nPushed);
+}
+
+TEST(AsyncWriter, bufferReuse) {
+    sim::BufferPool<std::vector<double>> pool(2);
+
+    // a released buffer is reused with its content and memory
+    auto buffer = pool.acquire();
+    buffer->assign(100, 1.0);
+    const double* data = buffer->data();
+    buffer.reset();
+    ASSERT_EQ(pool.getReleasedBuffers(), 1u);
+    buffer = pool.acquire();
+    ASSERT_EQ(buffer->size(), 100u);
+    ASSERT_EQ(buffer->data(), data);
+    ASSERT_EQ(pool.getCreatedBuffers(), 1u);
+    ASSERT_EQ(pool.getReleasedBuffers(), 0u);
+
+    // buffers in use are not shared, and only the maximal number of released buffers is kept
+    auto second = pool.acquire();
+    auto third = pool.acquire();
+    ASSERT_NE(buffer, second);
+    ASSERT_NE(second, third);
+    ASSERT_EQ(pool.getCreatedBuffers(), 3u);
+    buffer.reset();
+    second.reset();
+    third.reset();
+    ASSERT_EQ(pool.getReleasedBuffers(), 2u);
+}
+
+TEST(AsyncWriter, bufferPoolWriter) {
+    std::vector<double> sums;
+    auto pool = std::make_unique<sim::BufferPool<std::vector<double>>>(3);
+    {
+        sim::AsyncWriter writer(2);
+        for (int i = 0; i < 50; ++i) {
+            std::shared_ptr<std::vector<double>> buffer = pool->acquire();
+            buffer->assign(10, double(i));
+            writer.push([buffer, &sums]() {
+                double sum = 0.0;
+                for (double value : *buffer) {
+                    sum += value;
+                }
+                sums.push_back(sum);
+            });
+        }
+        // the buffers of the queued tasks outlive the pool
+        pool.reset();
+    }
+    ASSERT_EQ(sums.size(), 50u);
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_EQ(sums[i], 10.0 * i);
+    }
+}
+
+TEST(AsyncWriter, bufferPoolBounded) {
+    sim::BufferPool<std::vector<double>> pool(3);
+    sim::AsyncWriter writer(2);
+    for (int i = 0; i < 50; ++i) {
+        std::shared_ptr<std::vector<double>> buffer = pool.acquire();
+        buffer->assign(10, double(i));
+        writer.push([buffer]() { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+    }
+    writer.flush();
+
+    // the queued tasks and the buffer that is filled are the only buffers in use at the same time
+    ASSERT_LE(pool.getCreatedBuffers(), 3u);
+}
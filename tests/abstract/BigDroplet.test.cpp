@@ -4,6 +4,74 @@
 
 using T = double;
 
+/**
+ * Network and simulation of a definition, which are simulated on construction.
+*/
+struct SimulatedDefinition {
+    arch::Network<T> network;
+    sim::Simulation<T> simulation;
+
+    explicit SimulatedDefinition(const nlohmann::json& definition) :
+        network(porting::networkFromJSON<T>(definition)),
+        simulation(porting::simulationFromJSON<T>(definition, &network)) {
+        simulation.simulate();
+    }
+
+    const result::StateStore<T>& getStates() {
+        return simulation.getSimulationResults()->getStates();
+    }
+};
+
+/**
+ * Loads the definition of the droplet network Network1.JSON.
+*/
+nlohmann::json loadDropletNetwork1() {
+    std::ifstream f("../examples/Abstract/Droplet/Network1.JSON");
+    return nlohmann::json::parse(f);
+}
+
+/**
+ * Expects that two states of the same simulation, e.g., stored in different ways, contain the same values.
+*/
+void expectEqualStates(const result::State<T>& expected, const result::State<T>& actual) {
+    EXPECT_EQ(expected.id, actual.id);
+    EXPECT_EQ(expected.time, actual.time);
+    EXPECT_EQ(expected.pressures, actual.pressures);
+    EXPECT_EQ(expected.flowRates, actual.flowRates);
+    ASSERT_EQ(expected.dropletPositions.size(), actual.dropletPositions.size());
+    for (auto& [dropletId, position] : expected.dropletPositions) {
+        auto& actualPosition = actual.dropletPositions.at(dropletId);
+        EXPECT_EQ(position.channelIds, actualPosition.channelIds);
+        ASSERT_EQ(position.boundaries.size(), actualPosition.boundaries.size());
+        for (size_t i = 0; i < position.boundaries.size(); ++i) {
+            EXPECT_EQ(position.boundaries[i].getChannelPosition().getPosition(), actualPosition.boundaries[i].getChannelPosition().getPosition());
+        }
+    }
+}
+
+/**
+ * Simulates Network1.JSON as defined, with all states in memory, and with the changes of a variant of its definition.
+ * Expects that the retained states of the variant equal the last states of the reference.
+ * @returns The reference and the variant.
+*/
+template<typename Modify>
+std::pair<std::unique_ptr<SimulatedDefinition>, std::unique_ptr<SimulatedDefinition>> simulateVariant(Modify modify) {
+    nlohmann::json definition = loadDropletNetwork1();
+    auto reference = std::make_unique<SimulatedDefinition>(definition);
+    modify(definition);
+    auto variant = std::make_unique<SimulatedDefinition>(definition);
+
+    auto& referenceStates = reference->getStates();
+    auto& variantStates = variant->getStates();
+    EXPECT_EQ(variantStates.getAddedStates(), referenceStates.size());
+    EXPECT_LE(variantStates.size(), referenceStates.size());
+    const size_t offset = referenceStates.size() - std::min(variantStates.size(), referenceStates.size());
+    for (size_t i = 0; i + offset < referenceStates.size(); ++i) {
+        expectEqualStates(*referenceStates.at(offset + i), *variantStates.at(i));
+    }
+    return { std::move(reference), std::move(variant) };
+}
+
 TEST(BigDroplet, allResultValues) {
     // define simulation
     sim::Simulation<T> testSimulation;
@@ -1028,3 +1096,408 @@ TEST(BigDroplet, noSinkTwoDroplets) {
     // simulate
     testSimulation.simulate();
 }
+
+/**
+ * Expects that a droplet of a state has the given boundaries, i.e., pairs of channel ids and relative positions.
+*/
+void expectDropletBoundaries(const result::State<T>& state, int dropletId, const std::vector<std::pair<int, T>>& boundaries) {
+    ASSERT_TRUE(state.dropletPositions.count(dropletId));
+    auto& position = state.dropletPositions.at(dropletId);
+    ASSERT_EQ(position.boundaries.size(), boundaries.size());
+    for (size_t i = 0; i < boundaries.size(); ++i) {
+        EXPECT_EQ(position.boundaries[i].getChannelPosition().getChannel()->getId(), boundaries[i].first);
+        EXPECT_NEAR(position.boundaries[i].getChannelPosition().getPosition(), boundaries[i].second, 1e-12);
+    }
+}
+
+TEST(BigDroplet, mergeChannel) {
+    // define simulation
+    sim::Simulation<T> testSimulation;
+    testSimulation.setType(sim::Type::Abstract);
+    testSimulation.setPlatform(sim::Platform::BigDroplet);
+
+    // define network
+    arch::Network<T> network;
+    testSimulation.setNetwork(&network);
+
+    // nodes
+    auto node0 = network.addNode(0.0, 0.0, false);
+    auto node1 = network.addNode(1e-3, 0.0, false);
+    auto node2 = network.addNode(2e-3, 0.0, false);
+    auto node3 = network.addNode(3e-3, 0.0, false);
+
+    // flowRate pump
+    auto flowRate = 3e-11;
+    network.addFlowRatePump(node3->getId(), node0->getId(), flowRate);
+
+    // channels, the inlet channel c0 splits into the parallel channels c1 and c2
+    auto cWidth = 100e-6;
+    auto cHeight = 30e-6;
+    auto cLength = 1000e-6;
+
+    auto c0 = network.addChannel(node0->getId(), node1->getId(), cHeight, cWidth, 2 * cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node1->getId(), node2->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c2 = network.addChannel(node1->getId(), node2->getId(), cHeight, cWidth, 2 * cLength, arch::ChannelType::NORMAL);
+    auto c3 = network.addChannel(node2->getId(), node3->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+    //--- sink ---
+    network.setSink(node3->getId());
+    //--- ground ---
+    network.setGround(node3->getId());
+
+    // fluids
+    auto fluid0 = testSimulation.addFluid(1e-3, 1e3, 1.0);
+    auto fluid1 = testSimulation.addFluid(3e-3, 1e3, 1.0);
+    //--- continuousPhase ---
+    testSimulation.setContinuousPhase(fluid0->getId());
+
+    // droplets, the second droplet catches up with the first one, when the first one slows down at the split
+    auto dropletVolume = 1.5 * cWidth * cWidth * cHeight;
+    auto droplet0 = testSimulation.addDroplet(fluid1->getId(), dropletVolume);
+    auto droplet1 = testSimulation.addDroplet(fluid1->getId(), dropletVolume);
+    testSimulation.addDropletInjection(droplet0->getId(), 0.0, c0->getId(), 0.3);
+    testSimulation.addDropletInjection(droplet1->getId(), 0.0, c0->getId(), 0.1);
+
+    // Define and set the resistance model
+    sim::ResistanceModel1D<T> resistanceModel = sim::ResistanceModel1D<T>(testSimulation.getContinuousPhase()->getViscosity());
+    testSimulation.setResistanceModel(&resistanceModel);
+
+    // check if chip is valid
+    network.isNetworkValid();
+    network.sortGroups();
+
+    // simulate
+    testSimulation.simulate();
+
+    // the expected values are the results of the pairwise comparison of all boundaries inside a channel
+    auto& states = testSimulation.getSimulationResults()->getStates();
+    std::vector<T> times = { 0.0, 0.0, 0.0, 0.048828125000000021, 0.064453124999999986, 0.081097146739130474,
+        0.23969089673913069, 0.27454666596989996, 0.32923416596990007 };
+    ASSERT_EQ(states.size(), times.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+        EXPECT_NEAR(states.at(i)->getTime(), times[i], 1e-12);
+    }
+
+    // the tail of droplet0 and the head of droplet1 meet inside c0
+    auto state = states.at(3);
+    expectDropletBoundaries(*state, droplet0->getId(), { { c0->getId(), 0.85 }, { c2->getId(), 0.0 } });
+    expectDropletBoundaries(*state, droplet1->getId(), { { c0->getId(), 0.65 }, { c0->getId(), 0.8 } });
+    state = states.at(4);
+    ASSERT_EQ(state->dropletPositions.size(), 3u);
+    expectDropletBoundaries(*state, 2, { { c0->getId(), 0.84999999999999953 }, { c2->getId(), 0.14999999999999958 } });
+
+    // the merged droplet leaves the network through c2 and c3
+    expectDropletBoundaries(*states.at(5), 2, { { c2->getId(), 0.0 }, { c2->getId(), 0.30000000000000004 } });
+    expectDropletBoundaries(*states.at(6), 2, { { c2->getId(), 0.7 }, { c3->getId(), 0.0 } });
+    expectDropletBoundaries(*states.at(8), 2, { { c3->getId(), 0.7 }, { c3->getId(), 1.0 } });
+}
+
+TEST(BigDroplet, mergeBifurcation) {
+    // define simulation
+    sim::Simulation<T> testSimulation;
+    testSimulation.setType(sim::Type::Abstract);
+    testSimulation.setPlatform(sim::Platform::BigDroplet);
+
+    // define network
+    arch::Network<T> network;
+    testSimulation.setNetwork(&network);
+
+    // nodes
+    auto node0 = network.addNode(0.0, 0.0, false);
+    auto node1 = network.addNode(1e-3, 0.0, false);
+    auto node2 = network.addNode(2e-3, 0.0, false);
+    auto node3 = network.addNode(3e-3, 0.0, false);
+    auto node4 = network.addNode(0.0, 1e-3, false);
+
+    // flowRate pumps
+    auto flowRate = 3e-11;
+    network.addFlowRatePump(node3->getId(), node0->getId(), flowRate);
+    network.addFlowRatePump(node3->getId(), node4->getId(), flowRate);
+
+    // channels, the inlet channels c0 and c1 join into c2
+    auto cWidth = 100e-6;
+    auto cHeight = 30e-6;
+    auto cLength = 1000e-6;
+
+    auto c0 = network.addChannel(node0->getId(), node1->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c1 = network.addChannel(node4->getId(), node1->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c2 = network.addChannel(node1->getId(), node2->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c3 = network.addChannel(node2->getId(), node3->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+    //--- sink ---
+    network.setSink(node3->getId());
+    //--- ground ---
+    network.setGround(node3->getId());
+
+    // fluids
+    auto fluid0 = testSimulation.addFluid(1e-3, 1e3, 1.0);
+    auto fluid1 = testSimulation.addFluid(3e-3, 1e3, 1.0);
+    //--- continuousPhase ---
+    testSimulation.setContinuousPhase(fluid0->getId());
+
+    // droplets, droplet1 passes the junction while droplet0 arrives from the other inlet
+    auto dropletVolume = 1.5 * cWidth * cWidth * cHeight;
+    auto droplet0 = testSimulation.addDroplet(fluid1->getId(), dropletVolume);
+    auto droplet1 = testSimulation.addDroplet(fluid1->getId(), dropletVolume);
+    testSimulation.addDropletInjection(droplet0->getId(), 0.0, c0->getId(), 0.5);
+    testSimulation.addDropletInjection(droplet1->getId(), 0.0, c1->getId(), 0.7);
+
+    // Define and set the resistance model
+    sim::ResistanceModel1D<T> resistanceModel = sim::ResistanceModel1D<T>(testSimulation.getContinuousPhase()->getViscosity());
+    testSimulation.setResistanceModel(&resistanceModel);
+
+    // check if chip is valid
+    network.isNetworkValid();
+    network.sortGroups();
+
+    // simulate
+    testSimulation.simulate();
+
+    // the expected values are the results of the pairwise comparison of all boundaries inside a channel
+    auto& states = testSimulation.getSimulationResults()->getStates();
+    std::vector<T> times = { 0.0, 0.0, 0.0, 0.02728625536811943, 0.033203125000000014, 0.03604657055217915,
+        0.041963440184059723, 0.06930719018405973, 0.081025940184059744, 0.10836969018405976 };
+    ASSERT_EQ(states.size(), times.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+        EXPECT_NEAR(states.at(i)->getTime(), times[i], 1e-12);
+    }
+
+    // the head of droplet0 reaches the junction, while droplet1 occupies it
+    auto state = states.at(4);
+    ASSERT_EQ(state->dropletPositions.size(), 3u);
+    expectDropletBoundaries(*state, droplet0->getId(), { { c0->getId(), 0.85 }, { c0->getId(), 1.0 } });
+    expectDropletBoundaries(*state, droplet1->getId(), { { c1->getId(), 0.97426406871192839 }, { c2->getId(), 0.11360389693210714 } });
+    expectDropletBoundaries(*state, 2, { { c0->getId(), 0.85 }, { c1->getId(), 0.97426406871192839 }, { c2->getId(), 0.11360389693210714 } });
+
+    // the merged droplet leaves the network through c2 and c3
+    expectDropletBoundaries(*states.at(5), 2, { { c0->getId(), 0.88639610306789296 }, { c2->getId(), 0.186396103067893 } });
+    expectDropletBoundaries(*states.at(6), 2, { { c2->getId(), 0.0 }, { c2->getId(), 0.30000000000000004 } });
+    expectDropletBoundaries(*states.at(7), 2, { { c2->getId(), 0.7 }, { c3->getId(), 0.0 } });
+    expectDropletBoundaries(*states.at(9), 2, { { c3->getId(), 0.7 }, { c3->getId(), 1.0 } });
+}
+
+TEST(BigDroplet, deltaStateStorage) {
+    // simulate the same network with complete and delta-encoded states, random access reconstructs the states from the previous keyframe
+    auto [full, delta] = simulateVariant([](nlohmann::json& definition) {
+        definition["simulation"]["stateStorage"] = "Delta";
+        definition["simulation"]["keyframeInterval"] = 4;
+    });
+    auto& fullStates = full->getStates();
+    auto& deltaStates = delta->getStates();
+    EXPECT_EQ(deltaStates.getStorage(), result::StateStorage::Delta);
+    ASSERT_EQ(fullStates.size(), deltaStates.size());
+    EXPECT_LT(deltaStates.getStoredEntries(), fullStates.getStoredEntries());
+
+    // iterating reconstructs the states incrementally
+    size_t i = 0;
+    for (auto& state : deltaStates) {
+        expectEqualStates(*fullStates.at(i++), *state);
+    }
+    EXPECT_EQ(i, fullStates.size());
+}
+
+TEST(BigDroplet, columnarStateStorage) {
+    // simulate the same network with complete and columnar states
+    auto [full, columnar] = simulateVariant([](nlohmann::json& definition) {
+        definition["simulation"]["stateStorage"] = "Columnar";
+    });
+    auto& fullStates = full->getStates();
+    auto& columnarStates = columnar->getStates();
+    ASSERT_EQ(fullStates.size(), columnarStates.size());
+    EXPECT_EQ(columnarStates.getNodeIds().size(), full->network.getNodes().size());
+    EXPECT_TRUE(std::is_sorted(columnarStates.getNodeIds().begin(), columnarStates.getNodeIds().end()));
+    EXPECT_THROW(fullStates.getPressureRow(0), std::invalid_argument);
+
+    for (size_t i = 0; i < fullStates.size(); ++i) {
+        auto fullState = fullStates.at(i);
+        for (size_t column = 0; column < columnarStates.getEdgeIds().size(); ++column) {
+            EXPECT_EQ(columnarStates.getFlowRateRow(i)[column], fullState->flowRates.at(columnarStates.getEdgeIds()[column]));
+        }
+    }
+
+    // time series are read from a column, or gathered from the states
+    for (int nodeId : columnarStates.getNodeIds()) {
+        EXPECT_EQ(columnarStates.getPressureSeries(nodeId), fullStates.getPressureSeries(nodeId));
+    }
+    EXPECT_EQ(columnarStates.getTimes(), fullStates.getTimes());
+}
+
+TEST(BigDroplet, stateSinks) {
+    // stream all states to the sinks and keep only the last two states in memory
+    auto [full, streamed] = simulateVariant([](nlohmann::json& definition) {
+        definition["simulation"]["stateSinks"] = {
+            {{"format", "JsonLines"}, {"file", "stateSinks.jsonl"}},
+            {{"format", "Binary"}, {"file", "stateSinks.bin"}}
+        };
+        definition["simulation"]["retainedStates"] = 2;
+    });
+    auto& fullStates = full->getStates();
+    auto& states = streamed->getStates();
+    ASSERT_EQ(states.size(), 2u);
+    EXPECT_EQ(states.at(0)->id, static_cast<int>(fullStates.size()) - 2);
+
+    // each line contains one state
+    std::ifstream jsonLines("stateSinks.jsonl");
+    std::string line;
+    size_t nLines = 0;
+    while (std::getline(jsonLines, line)) {
+        auto state = nlohmann::json::parse(line);
+        auto fullState = fullStates.at(nLines);
+        EXPECT_EQ(state["time"], fullState->getTime());
+        EXPECT_EQ(state["nodes"].size(), fullState->getPressures().size());
+        EXPECT_EQ(state["bigDroplets"].size(), fullState->getDropletPositions().size());
+        nLines++;
+    }
+    EXPECT_EQ(nLines, fullStates.size());
+
+    // the binary file contains a header with the ids and a row per state
+    porting::BinaryResult binary("stateSinks.bin");
+    ASSERT_EQ(binary.getNumberOfStates(), static_cast<int64_t>(fullStates.size()));
+    ASSERT_EQ(binary.getNumberOfNodes(), static_cast<int64_t>(streamed->network.getNodes().size()));
+    for (int64_t state = 0; state < binary.getNumberOfStates(); ++state) {
+        auto fullState = fullStates.at(state);
+        EXPECT_EQ(binary.getTime(state), fullState->getTime());
+        for (int64_t i = 0; i < binary.getNumberOfNodes(); ++i) {
+            EXPECT_EQ(binary.getPressures(state)[i], fullState->getPressures().at(binary.getNodeIds()[i]));
+        }
+        for (int64_t i = 0; i < binary.getNumberOfEdges(); ++i) {
+            EXPECT_EQ(binary.getFlowRates(state)[i], fullState->getFlowRates().at(binary.getEdgeIds()[i]));
+        }
+    }
+    EXPECT_EQ(binary.getDropletPositions().size, 0);
+}
+
+TEST(BigDroplet, unfinishedBinarySink) {
+    SimulatedDefinition run(loadDropletNetwork1());
+    auto& states = run.getStates();
+    ASSERT_GT(states.size(), 4u);
+
+    // the sink is flushed once after two states, and is never flushed after the last states, as after a crash
+    {
+        porting::BinarySink<T> sink("unfinishedBinarySink.bin");
+        for (size_t i = 0; i < states.size(); ++i) {
+            sink.write(states.at(i).get(), &run.simulation);
+            if (i == 1) {
+                sink.flush();
+            }
+        }
+    }
+    // incomplete row of a state that was written while the simulation stopped
+    {
+        std::ofstream append("unfinishedBinarySink.bin", std::ios::binary | std::ios::app);
+        const double partialRow[2] = { 1.0, 2.0 };
+        append.write(reinterpret_cast<const char*>(partialRow), sizeof(partialRow));
+    }
+
+    porting::BinaryResult binary("unfinishedBinarySink.bin");
+    ASSERT_EQ(static_cast<size_t>(binary.getNumberOfStates()), states.size());
+    for (int64_t state = 0; state < binary.getNumberOfStates(); ++state) {
+        EXPECT_EQ(binary.getTime(state), states.at(state)->getTime());
+        for (int64_t i = 0; i < binary.getNumberOfEdges(); ++i) {
+            EXPECT_EQ(binary.getFlowRates(state)[i], states.at(state)->getFlowRates().at(binary.getEdgeIds()[i]));
+        }
+    }
+
+    // a sink that was never flushed holds 0 states in its header
+    {
+        porting::BinarySink<T> sink("unfinishedBinarySink.bin");
+        for (size_t i = 0; i < 3; ++i) {
+            sink.write(states.at(i).get(), &run.simulation);
+        }
+    }
+    porting::BinaryResult unflushed("unfinishedBinarySink.bin");
+    ASSERT_EQ(unflushed.getNumberOfStates(), 3);
+    EXPECT_EQ(unflushed.getTime(2), states.at(2)->getTime());
+}
+
+TEST(BigDroplet, binaryResult) {
+    SimulatedDefinition run(loadDropletNetwork1());
+    porting::resultToBinary<T>("binaryResult.bin", &run.simulation);
+
+    auto& states = run.getStates();
+    porting::BinaryResult binary("binaryResult.bin");
+    ASSERT_EQ(binary.getNumberOfStates(), static_cast<int64_t>(states.size()));
+    ASSERT_EQ(binary.getNumberOfEdges(), static_cast<int64_t>(run.network.getChannels().size() + run.network.getFlowRatePumps().size()));
+    EXPECT_TRUE(std::is_sorted(binary.getNodeIds(), binary.getNodeIds() + binary.getNumberOfNodes()));
+    for (int64_t state = 0; state < binary.getNumberOfStates(); ++state) {
+        EXPECT_EQ(binary.getTime(state), states.at(state)->getTime());
+        for (int64_t i = 0; i < binary.getNumberOfNodes(); ++i) {
+            EXPECT_EQ(binary.getPressures(state)[i], states.at(state)->getPressures().at(binary.getNodeIds()[i]));
+        }
+    }
+
+    // the droplet positions are stored per state in ascending order of the droplet ids
+    auto& droplets = binary.getDropletPositions();
+    int64_t position = 0;
+    for (int64_t state = 0; state < binary.getNumberOfStates(); ++state) {
+        auto dropletPositions = states.at(state)->getDropletPositions();
+        std::map<int, sim::DropletPosition<T>> sortedPositions(dropletPositions.begin(), dropletPositions.end());
+        for (auto& [dropletId, dropletPosition] : sortedPositions) {
+            ASSERT_LT(position, droplets.size);
+            EXPECT_EQ(droplets.states[position], state);
+            EXPECT_EQ(droplets.dropletIds[position], dropletId);
+            int64_t first = droplets.boundaryOffsets[position];
+            ASSERT_EQ(droplets.boundaryOffsets[position + 1] - first, dropletPosition.boundaries.size());
+            for (size_t i = 0; i < dropletPosition.boundaries.size(); ++i) {
+                auto& boundary = dropletPosition.boundaries[i];
+                EXPECT_EQ(droplets.boundaryChannels[first + i], boundary.getChannelPosition().getChannel()->getId());
+                EXPECT_EQ(droplets.volumeTowardsNodeA[first + i], boundary.isVolumeTowardsNodeA());
+                EXPECT_EQ(droplets.boundaryPositions[first + i], boundary.getChannelPosition().getPosition());
+            }
+            EXPECT_EQ(droplets.channelOffsets[position + 1] - droplets.channelOffsets[position], dropletPosition.channelIds.size());
+            position++;
+        }
+    }
+    EXPECT_EQ(position, droplets.size);
+    EXPECT_THROW(porting::BinaryResult("../examples/Abstract/Droplet/Network1.JSON"), std::runtime_error);
+}
+
+TEST(BigDroplet, parameterSweep) {
+    nlohmann::json jsonString = loadDropletNetwork1();
+
+    // variants of the flow rate of the pump and the injection time of the droplet, and an undefined pump
+    std::vector<T> flowRates = { 3e-11, 4.5e-11, 6e-11 };
+    std::vector<T> injectionTimes = { 0.0, 0.5, 1.0 };
+    std::vector<porting::SweepVariant<T>> variants;
+    for (T flowRate : flowRates) {
+        for (T injectionTime : injectionTimes) {
+            porting::SweepVariant<T> variant;
+            variant.flowRatePumps.try_emplace(6, flowRate);
+            variant.injectionTimes.try_emplace(0, injectionTime);
+            variants.push_back(variant);
+        }
+    }
+    porting::SweepVariant<T> invalid;
+    invalid.pressurePumps.try_emplace(6, 1000.0);
+    variants.push_back(invalid);
+
+    porting::ParameterSweep<T> sweep(jsonString);
+    sweep.setThreads(4);
+    auto results = sweep.run(variants);
+    ASSERT_EQ(results.size(), variants.size());
+    EXPECT_FALSE(results.back().error.empty());
+
+    // every run matches a simulation of the modified definition
+    for (size_t i = 0; i + 1 < variants.size(); ++i) {
+        nlohmann::json variantJson = jsonString;
+        variantJson["simulation"]["pumps"][0]["flowRate"] = flowRates[i / injectionTimes.size()];
+        variantJson["simulation"]["fixtures"][0]["bigDropletInjections"][0]["t0"] = injectionTimes[i % injectionTimes.size()];
+        SimulatedDefinition reference(variantJson);
+        auto& states = reference.getStates();
+        auto lastState = states.back();
+
+        EXPECT_TRUE(results[i].error.empty());
+        EXPECT_EQ(results[i].nStates, states.size());
+        EXPECT_EQ(results[i].time, lastState->getTime());
+        ASSERT_EQ(results[i].pressures.size(), sweep.getNodeIds().size());
+        ASSERT_EQ(results[i].flowRates.size(), sweep.getEdgeIds().size());
+        for (size_t j = 0; j < sweep.getNodeIds().size(); ++j) {
+            EXPECT_EQ(results[i].pressures[j], lastState->getPressures().at(sweep.getNodeIds()[j]));
+        }
+        for (size_t j = 0; j < sweep.getEdgeIds().size(); ++j) {
+            EXPECT_EQ(results[i].flowRates[j], lastState->getFlowRates().at(sweep.getEdgeIds()[j]));
+        }
+    }
+    EXPECT_NE(results[0].time, results[1].time);
+    EXPECT_NE(results[0].flowRates, results[injectionTimes.size()].flowRates);
+}
@@ -121,6 +121,39 @@ TEST(Continuous, jsonDefinition) {
 
 }
 
+TEST(Continuous, jsonResult) {
+    std::string file = "../examples/Abstract/Continuous/Network1.JSON";
+
+    // Load and set the network from a JSON file
+    arch::Network<T> network = porting::networkFromJSON<T>(file);
+
+    // Load and set the simulation from a JSON file
+    sim::Simulation<T> testSimulation = porting::simulationFromJSON<T>(file, &network);
+
+    network.sortGroups();
+    network.isNetworkValid();
+
+    // Perform simulation and write the results
+    testSimulation.simulate();
+    auto jsonResult = porting::resultToJSON<T>(&testSimulation);
+
+    // nodes and channels are written in ascending order of their ids
+    auto state = testSimulation.getSimulationResults()->getStates().at(0);
+    auto const& nodes = jsonResult["network"][0]["nodes"];
+    auto const& channels = jsonResult["network"][0]["channels"];
+    ASSERT_EQ(nodes.size(), state->getPressures().size());
+    ASSERT_EQ(channels.size(), state->getFlowRates().size());
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(nodes[i]["pressure"].get<T>(), state->getPressures().at(i));
+    }
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+        EXPECT_EQ(channels[i]["flowRate"].get<T>(), state->getFlowRates().at(i));
+    }
+
+    // writing the result again gives the same output
+    EXPECT_EQ(porting::resultToJSON<T>(&testSimulation).dump(), jsonResult.dump());
+}
+
 TEST(Continuous, triangleNetwork) {
     // define simulation 1
     sim::Simulation<T> testSimulation1;
@@ -0,0 +1,214 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+using T = double;
+
+/**
+ * Event that only stores an id, by which the order of the events is checked.
+*/
+class TestEvent : public sim::Event<T> {
+public:
+    int id;
+
+    TestEvent(T time, int priority, int id) : sim::Event<T>(time, priority), id(id) { }
+
+    void performEvent() override { }
+
+    void print() override { }
+};
+
+/**
+ * Take the events from the scheduler in their order, invalidating the group of each event after it was taken.
+*/
+std::vector<int> drain(sim::EventScheduler<T>& scheduler, T now = 0.0) {
+    std::vector<int> ids;
+    T timeStep = 0.0;
+    while (sim::Event<T>* event = scheduler.next(now, timeStep)) {
+        ids.push_back(static_cast<TestEvent*>(event)->id);
+        scheduler.invalidateNext();
+    }
+    return ids;
+}
+
+TEST(EventScheduler, ordering) {
+    sim::EventScheduler<T> scheduler;
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 3.0, 0, 3);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 1, 0.0, 1.0, 0, 1);
+    scheduler.schedule<TestEvent>(sim::EventSource::Injection, 0, 0.0, 2.0, 0, 2);
+    scheduler.schedule<TestEvent>(sim::EventSource::Channel, 0, 0.0, 0.5, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::TimeStep, 0, 0.0, 4.0, 0, 4);
+    ASSERT_EQ(scheduler.size(), 5u);
+
+    // the next event remains scheduled until its group is invalidated
+    T timeStep = 0.0;
+    ASSERT_EQ(static_cast<TestEvent*>(scheduler.next(0.0, timeStep))->id, 0);
+    ASSERT_EQ(static_cast<TestEvent*>(scheduler.next(0.0, timeStep))->id, 0);
+    ASSERT_EQ(timeStep, 0.5);
+    ASSERT_EQ(scheduler.size(), 5u);
+
+    ASSERT_EQ(drain(scheduler), std::vector<int>({ 0, 1, 2, 3, 4 }));
+    ASSERT_EQ(scheduler.size(), 0u);
+    ASSERT_EQ(scheduler.next(0.0, timeStep), nullptr);
+}
+
+TEST(EventScheduler, tieBreak) {
+    sim::EventScheduler<T> scheduler;
+
+    // at the same time, the lower priority value comes first
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 1.0, 2, 2);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 1, 0.0, 1.0, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 2, 0.0, 1.0, 1, 1);
+
+    // at the same time and priority, the event that was scheduled first comes first, regardless of its group
+    scheduler.schedule<TestEvent>(sim::EventSource::TimeStep, 5, 0.0, 2.0, 0, 3);
+    scheduler.schedule<TestEvent>(sim::EventSource::Injection, 4, 0.0, 2.0, 0, 4);
+    scheduler.schedule<TestEvent>(sim::EventSource::Channel, 3, 0.0, 2.0, 0, 5);
+
+    // the absolute time decides, not the time relative to the simulation time of the scheduling
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 6, 1.5, 0.0, 0, 6);
+
+    ASSERT_EQ(drain(scheduler), std::vector<int>({ 0, 1, 2, 6, 3, 4, 5 }));
+}
+
+TEST(EventScheduler, timeStep) {
+    sim::EventScheduler<T> scheduler;
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.1, 0.2, 0, 0);
+
+    // events that were scheduled at the current time keep their exact relative time
+    T timeStep = 0.0;
+    scheduler.next(0.1, timeStep);
+    ASSERT_EQ(timeStep, 0.2);
+
+    // events of earlier times take the remaining time until their absolute time
+    scheduler.next(0.25, timeStep);
+    ASSERT_EQ(timeStep, (0.1 + 0.2) - 0.25);
+}
+
+TEST(EventScheduler, invalidate) {
+    sim::EventScheduler<T> scheduler;
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 1.0, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 4.0, 0, 1);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 1, 0.0, 2.0, 0, 2);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 2, 0.0, 3.0, 0, 3);
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_EQ(scheduler.size(), 4u);
+
+    // all events of a group are removed together
+    scheduler.invalidate(sim::EventSource::Droplet, 0);
+    ASSERT_FALSE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_EQ(scheduler.size(), 2u);
+
+    // invalidating an empty or unknown group does nothing
+    scheduler.invalidate(sim::EventSource::Droplet, 0);
+    scheduler.invalidate(sim::EventSource::Droplet, 10);
+    ASSERT_EQ(scheduler.size(), 2u);
+
+    // a group that is scheduled again only contains its new events
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 2.5, 0, 4);
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    ASSERT_EQ(drain(scheduler), std::vector<int>({ 2, 4, 3 }));
+}
+
+TEST(EventScheduler, invalidateNext) {
+    sim::EventScheduler<T> scheduler;
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 1.0, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 3.0, 0, 1);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 1, 0.0, 2.0, 0, 2);
+
+    // the group of the next event is removed, including its later events
+    T timeStep = 0.0;
+    ASSERT_EQ(static_cast<TestEvent*>(scheduler.next(0.0, timeStep))->id, 0);
+    scheduler.invalidateNext();
+    ASSERT_FALSE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::Droplet, 1));
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(static_cast<TestEvent*>(scheduler.next(0.0, timeStep))->id, 2);
+
+    // without events, nothing is invalidated
+    scheduler.invalidateNext();
+    scheduler.invalidateNext();
+    ASSERT_EQ(scheduler.size(), 0u);
+    ASSERT_EQ(scheduler.next(0.0, timeStep), nullptr);
+}
+
+TEST(EventScheduler, groupSources) {
+    sim::EventScheduler<T> scheduler;
+
+    // groups with the same id but different sources are independent of each other
+    scheduler.schedule<TestEvent>(sim::EventSource::Injection, 0, 0.0, 1.0, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 2.0, 0, 1);
+    scheduler.schedule<TestEvent>(sim::EventSource::Channel, 0, 0.0, 3.0, 0, 2);
+    scheduler.schedule<TestEvent>(sim::EventSource::TimeStep, 0, 0.0, 4.0, 0, 3);
+
+    scheduler.invalidate(sim::EventSource::Droplet, 0);
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::Injection, 0));
+    ASSERT_FALSE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::Channel, 0));
+    ASSERT_TRUE(scheduler.isScheduled(sim::EventSource::TimeStep, 0));
+
+    scheduler.invalidate(sim::EventSource::TimeStep, 0);
+    ASSERT_EQ(drain(scheduler), std::vector<int>({ 0, 2 }));
+}
+
+TEST(EventScheduler, compaction) {
+    auto pool = std::make_shared<sim::MemoryPool>();
+    sim::EventScheduler<T> scheduler;
+    scheduler.setMemoryPool(pool);
+
+    const int nGroups = 200;
+    for (int i = 0; i < nGroups; ++i) {
+        scheduler.schedule<TestEvent>(sim::EventSource::Droplet, i, 0.0, T(i), 0, i);
+    }
+    ASSERT_EQ(scheduler.getQueueSize(), static_cast<size_t>(nGroups));
+
+    // invalidated events are released immediately, while their entries remain in the queue until they dominate it
+    for (int i = 0; i < 10; ++i) {
+        scheduler.invalidate(sim::EventSource::Droplet, 2*i + 1);
+    }
+    ASSERT_EQ(scheduler.size(), static_cast<size_t>(nGroups - 10));
+    ASSERT_EQ(scheduler.getQueueSize(), static_cast<size_t>(nGroups));
+    ASSERT_EQ(pool->getLiveObjects(), static_cast<size_t>(nGroups - 10));
+
+    // invalidate all groups except every tenth
+    for (int i = 0; i < nGroups; ++i) {
+        if (i % 10 != 0) {
+            scheduler.invalidate(sim::EventSource::Droplet, i);
+        }
+    }
+    ASSERT_EQ(scheduler.size(), static_cast<size_t>(nGroups / 10));
+    ASSERT_LE(scheduler.getQueueSize(), 2 * scheduler.size() + 64);
+    ASSERT_EQ(pool->getLiveObjects(), scheduler.size());
+
+    // the outdated entries of rescheduled groups are not taken
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 1, 0.0, 1000.0, 0, 1000);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 2, 0.0, 1001.0, 0, 1001);
+
+    std::vector<int> expected;
+    for (int i = 0; i < nGroups; i += 10) {
+        expected.push_back(i);
+    }
+    expected.push_back(1000);
+    expected.push_back(1001);
+    ASSERT_EQ(drain(scheduler), expected);
+    ASSERT_EQ(pool->getLiveObjects(), 0u);
+}
+
+TEST(EventScheduler, clear) {
+    auto pool = std::make_shared<sim::MemoryPool>();
+    sim::EventScheduler<T> scheduler;
+    scheduler.setMemoryPool(pool);
+    scheduler.schedule<TestEvent>(sim::EventSource::Droplet, 0, 0.0, 1.0, 0, 0);
+    scheduler.schedule<TestEvent>(sim::EventSource::Channel, 0, 0.0, 2.0, 0, 1);
+
+    scheduler.clear();
+    ASSERT_EQ(scheduler.size(), 0u);
+    ASSERT_EQ(scheduler.getQueueSize(), 0u);
+    ASSERT_FALSE(scheduler.isScheduled(sim::EventSource::Droplet, 0));
+    ASSERT_EQ(pool->getLiveObjects(), 0u);
+
+    T timeStep = 0.0;
+    ASSERT_EQ(scheduler.next(0.0, timeStep), nullptr);
+}
@@ -0,0 +1,175 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+using T = double;
+
+/**
+ * Simulates a generated continuous network and checks that the flow rate of the inlet pump leaves through the outlets.
+*/
+void testGeneratedContinuous(porting::NetworkTopology topology, int nNodes, int nOutlets) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = topology;
+    settings.nNodes = nNodes;
+    json definition = porting::generateSimulation<T>(settings);
+
+    arch::Network<T> network = porting::networkFromJSON<T>(definition);
+    sim::Simulation<T> testSimulation;
+    porting::simulationFromJSON<T>(definition, &network, testSimulation);
+    network.isNetworkValid();
+    testSimulation.simulate();
+
+    int nChannels = definition["network"]["channels"].size();
+    ASSERT_EQ(definition["network"]["nodes"].size(), static_cast<size_t>(nNodes + 1 + nOutlets));
+
+    T outflow = 0.0;
+    auto state = testSimulation.getSimulationResults()->getStates().at(0);
+    auto& flowRates = state->getFlowRates();
+    for (int channelId = nChannels - nOutlets; channelId < nChannels; ++channelId) {
+        outflow += flowRates.at(channelId);
+    }
+    EXPECT_NEAR(std::abs(outflow), settings.flowRate, 1e-6 * settings.flowRate);
+}
+
+TEST(Generator, grid) {
+    testGeneratedContinuous(porting::NetworkTopology::Grid, 100, 1);
+}
+
+TEST(Generator, gridIncompleteRow) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Grid;
+
+    // apart from the inlet (first) and the outlet (last node), no node is dangling, also with an incomplete last row
+    for (int nNodes = 2; nNodes <= 30; ++nNodes) {
+        settings.nNodes = nNodes;
+        auto layout = porting::generateGrid<T>(settings);
+        std::vector<int> degree(nNodes, 0);
+        for (auto& [nodeA, nodeB] : layout.edges) {
+            degree[nodeA]++;
+            degree[nodeB]++;
+        }
+        for (int node = 1; node < nNodes - 1; ++node) {
+            EXPECT_GE(degree[node], 2) << "node " << node << " of " << nNodes << " nodes";
+        }
+    }
+
+    // two rows, of which the second is incomplete
+    testGeneratedContinuous(porting::NetworkTopology::Grid, 3, 1);
+    testGeneratedContinuous(porting::NetworkTopology::Grid, 5, 1);
+}
+
+TEST(Generator, ladder) {
+    testGeneratedContinuous(porting::NetworkTopology::Ladder, 100, 1);
+}
+
+TEST(Generator, tree) {
+    // a binary tree with 63 nodes has 32 leaves
+    testGeneratedContinuous(porting::NetworkTopology::Tree, 63, 32);
+}
+
+TEST(Generator, random) {
+    testGeneratedContinuous(porting::NetworkTopology::Random, 100, 1);
+}
+
+TEST(Generator, ladderOddNodes) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Ladder;
+    for (int nNodes : { 0, 1, 3, 99 }) {
+        settings.nNodes = nNodes;
+        EXPECT_THROW(porting::generateLadder<T>(settings), std::invalid_argument);
+        EXPECT_THROW(porting::generateNetwork<T>(settings), std::invalid_argument);
+    }
+
+    // the smallest ladder is a single rung
+    settings.nNodes = 2;
+    auto layout = porting::generateLadder<T>(settings);
+    EXPECT_EQ(layout.positions.size(), 2u);
+    EXPECT_EQ(layout.edges.size(), 1u);
+    testGeneratedContinuous(porting::NetworkTopology::Ladder, 2, 1);
+}
+
+TEST(Generator, randomSmall) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Random;
+    settings.nNodes = 1;
+    EXPECT_THROW(porting::generateRandom<T>(settings), std::invalid_argument);
+
+    // apart from the inlet (first) and the outlet (last node), no node is dangling, also with an incomplete last row
+    for (int nNodes = 2; nNodes <= 20; ++nNodes) {
+        for (unsigned int seed = 0; seed < 10; ++seed) {
+            settings.nNodes = nNodes;
+            settings.seed = seed;
+            auto layout = porting::generateRandom<T>(settings);
+            ASSERT_EQ(layout.positions.size(), static_cast<size_t>(nNodes));
+            std::vector<int> degree(nNodes, 0);
+            for (auto& [nodeA, nodeB] : layout.edges) {
+                degree[nodeA]++;
+                degree[nodeB]++;
+            }
+            for (int node = 1; node < nNodes - 1; ++node) {
+                EXPECT_GE(degree[node], 2) << "node " << node << " of " << nNodes << " nodes, seed " << seed;
+            }
+        }
+    }
+    testGeneratedContinuous(porting::NetworkTopology::Random, 3, 1);
+}
+
+TEST(Generator, randomSeed) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Random;
+    settings.nNodes = 50;
+    settings.seed = 3;
+    json first = porting::generateNetwork<T>(settings);
+    EXPECT_EQ(first, porting::generateNetwork<T>(settings));
+
+    // the spanning tree connects all nodes
+    EXPECT_GE(first["network"]["channels"].size(), 50u);
+}
+
+TEST(Generator, bigDroplet) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Ladder;
+    settings.nNodes = 32;
+    settings.platform = "BigDroplet";
+    settings.nDroplets = 4;
+    json definition = porting::generateSimulation<T>(settings);
+    ASSERT_EQ(definition["simulation"]["fixtures"][0]["bigDropletInjections"].size(), 4u);
+
+    arch::Network<T> network = porting::networkFromJSON<T>(definition);
+    sim::Simulation<T> testSimulation;
+    porting::simulationFromJSON<T>(definition, &network, testSimulation);
+    testSimulation.simulate();
+
+    // all droplets are injected
+    size_t nDroplets = 0;
+    for (auto& state : testSimulation.getSimulationResults()->getStates()) {
+        nDroplets = std::max(nDroplets, state->getDropletPositions().size());
+    }
+    EXPECT_EQ(nDroplets, 4u);
+}
+
+TEST(Generator, instantaneousMixing) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Tree;
+    settings.nNodes = 15;
+    settings.platform = "Mixing";
+    settings.nMixtureInjections = 2;
+    json definition = porting::generateSimulation<T>(settings);
+    ASSERT_EQ(definition["simulation"]["fixtures"][0]["mixtureInjections"].size(), 2u);
+
+    arch::Network<T> network = porting::networkFromJSON<T>(definition);
+    sim::Simulation<T> testSimulation;
+    porting::simulationFromJSON<T>(definition, &network, testSimulation);
+    testSimulation.simulate();
+
+    EXPECT_GT(testSimulation.getSimulationResults()->getStates().size(), 1u);
+}
+
+TEST(Generator, tooManyDroplets) {
+    porting::GeneratorSettings<T> settings;
+    settings.topology = porting::NetworkTopology::Ladder;
+    settings.nNodes = 4;
+    settings.platform = "BigDroplet";
+    settings.nDroplets = 10;
+    EXPECT_THROW(porting::generateSimulation<T>(settings), std::invalid_argument);
+}
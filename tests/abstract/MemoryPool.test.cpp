@@ -0,0 +1,152 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+/**
+ * Small object, whose size is no multiple of the slot alignment.
+*/
+struct PooledObject {
+    double value;
+    int id;
+};
+
+/**
+ * Object that is larger than the largest slot of the pool.
+*/
+struct LargeObject {
+    char data[1024];
+};
+
+TEST(MemoryPool, slotReuse) {
+    sim::MemoryPool pool(1024);
+
+    void* first = pool.allocate(sizeof(PooledObject));
+    void* second = pool.allocate(sizeof(PooledObject));
+    ASSERT_NE(first, second);
+    ASSERT_EQ(pool.getLiveObjects(), 2u);
+
+    // released slots are reused in the reverse order of their release
+    pool.deallocate(first, sizeof(PooledObject));
+    pool.deallocate(second, sizeof(PooledObject));
+    ASSERT_EQ(pool.getLiveObjects(), 0u);
+    ASSERT_EQ(pool.allocate(sizeof(PooledObject)), second);
+    ASSERT_EQ(pool.allocate(sizeof(PooledObject)), first);
+
+    // sizes that are rounded up to the same slot size share their slots
+    pool.deallocate(first, sizeof(PooledObject));
+    ASSERT_EQ(pool.allocate(1), first);
+
+    // a released slot is not reused for objects of another slot size
+    pool.deallocate(first, 1);
+    void* third = pool.allocate(200);
+    ASSERT_NE(third, first);
+    ASSERT_NE(third, second);
+
+    ASSERT_EQ(pool.getAllocations(), 6u);
+    ASSERT_EQ(pool.getHeapAllocations(), 1u);
+    ASSERT_EQ(pool.getLiveObjects(), 2u);
+}
+
+TEST(MemoryPool, steadyState) {
+    sim::MemoryPool pool(1024);
+
+    // once the number of living objects stops growing, no more memory is requested from the heap
+    std::vector<void*> objects;
+    for (int i = 0; i < 100; ++i) {
+        objects.push_back(pool.allocate(48));
+    }
+    std::size_t heapAllocations = pool.getHeapAllocations();
+    for (int round = 0; round < 10; ++round) {
+        for (void* object : objects) {
+            pool.deallocate(object, 48);
+        }
+        for (void*& object : objects) {
+            object = pool.allocate(48);
+        }
+    }
+    ASSERT_EQ(pool.getHeapAllocations(), heapAllocations);
+    ASSERT_EQ(pool.getAllocations(), 1100u);
+    ASSERT_EQ(pool.getLiveObjects(), 100u);
+}
+
+TEST(MemoryPool, chunkGrowth) {
+    sim::MemoryPool pool(1024);
+    ASSERT_EQ(pool.getReservedBytes(), 0u);
+
+    // 16 slots of 64 bytes fill the first chunk
+    for (int i = 0; i < 16; ++i) {
+        pool.allocate(64);
+    }
+    ASSERT_EQ(pool.getHeapAllocations(), 1u);
+    ASSERT_EQ(pool.getReservedBytes(), 1024u);
+
+    // the next slot does not fit into the first chunk anymore
+    pool.allocate(64);
+    ASSERT_EQ(pool.getHeapAllocations(), 2u);
+    ASSERT_EQ(pool.getReservedBytes(), 2048u);
+
+    // the largest slot size still fits into the second chunk
+    pool.allocate(512);
+    ASSERT_EQ(pool.getHeapAllocations(), 2u);
+    pool.allocate(512);
+    ASSERT_EQ(pool.getHeapAllocations(), 3u);
+    ASSERT_EQ(pool.getReservedBytes(), 3072u);
+}
+
+TEST(MemoryPool, largeObjects) {
+    sim::MemoryPool pool(1024);
+
+    // the largest pooled slot is taken from a chunk
+    void* pooled = pool.allocate(512);
+    ASSERT_EQ(pool.getHeapAllocations(), 1u);
+    ASSERT_EQ(pool.getReservedBytes(), 1024u);
+
+    // larger objects are allocated on the heap directly and do not reserve chunks
+    void* large = pool.allocate(513);
+    ASSERT_EQ(pool.getHeapAllocations(), 2u);
+    ASSERT_EQ(pool.getReservedBytes(), 1024u);
+    pool.deallocate(large, 513);
+    void* larger = pool.allocate(sizeof(LargeObject));
+    ASSERT_EQ(pool.getHeapAllocations(), 3u);
+    ASSERT_EQ(pool.getReservedBytes(), 1024u);
+    pool.deallocate(larger, sizeof(LargeObject));
+
+    // the released large objects are not stored as free slots
+    pool.deallocate(pooled, 512);
+    ASSERT_EQ(pool.allocate(512), pooled);
+    ASSERT_EQ(pool.getLiveObjects(), 1u);
+
+    // pooled pointers of large objects are released through the heap as well
+    auto object = sim::makePooled<LargeObject, LargeObject>(&pool);
+    object->data[1023] = 'a';
+    ASSERT_EQ(pool.getHeapAllocations(), 4u);
+    object.reset();
+    ASSERT_EQ(pool.getLiveObjects(), 1u);
+}
+
+TEST(MemoryPool, alignment) {
+    sim::MemoryPool pool(1000);
+
+    // the chunk size is rounded up to the alignment, such that all slots of a chunk are aligned
+    ASSERT_EQ(pool.getReservedBytes(), 0u);
+    pool.allocate(1);
+    ASSERT_EQ(pool.getReservedBytes() % alignof(std::max_align_t), 0u);
+
+    std::vector<std::pair<void*, std::size_t>> objects;
+    for (std::size_t size : { 1, 3, 8, 17, 33, 100, 255, 512, 513, 2000 }) {
+        for (int i = 0; i < 20; ++i) {
+            objects.emplace_back(pool.allocate(size), size);
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(objects.back().first) % alignof(std::max_align_t), 0u);
+        }
+    }
+    for (auto& [pointer, size] : objects) {
+        pool.deallocate(pointer, size);
+    }
+
+    auto object = sim::makePooled<PooledObject, PooledObject>(&pool, PooledObject{ 1.0, 2 });
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(object.get()) % alignof(PooledObject), 0u);
+    ASSERT_EQ(object->value, 1.0);
+    ASSERT_EQ(object->id, 2);
+}
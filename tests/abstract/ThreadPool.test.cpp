@@ -0,0 +1,85 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+
+TEST(ThreadPool, threads) {
+    ASSERT_EQ(sim::ThreadPool(1).getThreads(), 1u);
+    ASSERT_EQ(sim::ThreadPool(3).getThreads(), 3u);
+    ASSERT_GE(sim::ThreadPool(0).getThreads(), 1u);
+}
+
+TEST(ThreadPool, allTasks) {
+    sim::ThreadPool pool(4);
+
+    // every task is executed exactly once per batch, also when the batches are repeated, e.g., once per lattice step
+    std::vector<int> executions(7, 0);
+    for (int batch = 0; batch < 500; ++batch) {
+        pool.run(executions.size(), [&](int i) { executions[i]++; });
+    }
+    ASSERT_EQ(executions, std::vector<int>(7, 500));
+
+    // batches without or with a single task are executed on the calling thread
+    pool.run(0, [&](int) { FAIL(); });
+    std::thread::id caller;
+    pool.run(1, [&](int) { caller = std::this_thread::get_id(); });
+    ASSERT_EQ(caller, std::this_thread::get_id());
+}
+
+TEST(ThreadPool, concurrent) {
+    sim::ThreadPool pool(3);
+
+    // the tasks of a batch run on different threads at the same time, since each task waits for the others
+    std::atomic<int> started{0};
+    std::set<std::thread::id> threads;
+    std::mutex threadsMutex;
+    pool.run(3, [&](int) {
+        started++;
+        while (started < 3) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        threads.insert(std::this_thread::get_id());
+    });
+    ASSERT_EQ(threads.size(), 3u);
+}
+
+TEST(ThreadPool, barrier) {
+    sim::ThreadPool pool(4);
+
+    // run() only returns once the slowest task of the batch is finished
+    std::atomic<int> finished{0};
+    pool.run(8, [&](int i) {
+        if (i == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        finished++;
+    });
+    ASSERT_EQ(finished, 8);
+}
+
+TEST(ThreadPool, exceptionPropagation) {
+    sim::ThreadPool pool(4);
+
+    // the remaining tasks of the batch are still executed and the pool remains usable
+    std::atomic<int> executed{0};
+    try {
+        pool.run(8, [&](int i) {
+            executed++;
+            if (i == 5) {
+                throw std::runtime_error("task");
+            }
+        });
+        FAIL() << "run() did not rethrow the exception of the task.";
+    } catch (const std::runtime_error& e) {
+        ASSERT_STREQ(e.what(), "task");
+    }
+    ASSERT_EQ(executed, 8);
+
+    executed = 0;
+    ASSERT_NO_THROW(pool.run(8, [&](int) { executed++; }));
+    ASSERT_EQ(executed, 8);
+}
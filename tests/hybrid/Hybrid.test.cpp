@@ -4,6 +4,8 @@
 #endif
 #include "gtest/gtest.h"
 
+#include <fstream>
+
 using T = double;
 
 TEST(Hybrid, Case1a) {
@@ -113,6 +115,121 @@ TEST(Hybrid, Case1a) {
     EXPECT_NEAR(network.getChannels().at(8)->getFlowRate(), 4.69188e-9, 1e-14);
 }
 
+/**
+ * Simulate case 1a with the naive or the Aitken update scheme.
+ * @returns The number of coupling iterations until the pressures converged.
+*/
+int simulateCase1a(arch::Network<T>& network, bool aitken) {
+    // define simulation
+    sim::Simulation<T> testSimulation;
+    testSimulation.setType(sim::Type::Hybrid);
+    testSimulation.setPlatform(sim::Platform::Continuous);
+
+    // define network
+    testSimulation.setNetwork(&network);
+    
+    // nodes
+    auto node0 = network.addNode(0.0, 0.0, true);
+    auto node1 = network.addNode(1e-3, 2e-3, false);
+    auto node2 = network.addNode(1e-3, 1e-3, false);
+    auto node3 = network.addNode(1e-3, 0.0, false);
+    auto node4 = network.addNode(2e-3, 2e-3, false);
+    auto node5 = network.addNode(1.75e-3, 1e-3, false);
+    auto node6 = network.addNode(2e-3, 0.0, false);
+    auto node7 = network.addNode(2e-3, 1.25e-3, false);
+    auto node8 = network.addNode(2e-3, 0.75e-3, false);
+    auto node9 = network.addNode(2.25e-3, 1e-3, false);
+    auto node10 = network.addNode(3e-3, 1e-3, true);
+
+    // channels
+    auto cWidth = 100e-6;
+    auto cHeight = 100e-6;
+    auto cLength = 1000e-6;
+
+    auto c0 = network.addChannel(node0->getId(), node1->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c1 = network.addChannel(node0->getId(), node2->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c2 = network.addChannel(node0->getId(), node3->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node4->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node6->getId(), node8->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network.addChannel(node9->getId(), node10->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+    // module
+    std::vector<T> position = { 1.75e-3, 0.75e-3 };
+    std::vector<T> size = { 5e-4, 5e-4 };
+    std::unordered_map<int, std::shared_ptr<arch::Node<T>>> nodes;
+
+    nodes.try_emplace(5, network.getNode(5));
+    nodes.try_emplace(7, network.getNode(7));
+    nodes.try_emplace(8, network.getNode(8));
+    nodes.try_emplace(9, network.getNode(9));
+
+    auto m0 = network.addModule(position, size, nodes);
+
+    // fluids
+    auto fluid0 = testSimulation.addFluid(1e-3, 1e3, 1.0);
+    //--- continuousPhase ---
+    testSimulation.setContinuousPhase(fluid0->getId());
+
+    sim::ResistanceModelPoiseuille<T> resistanceModel = sim::ResistanceModelPoiseuille<T>(testSimulation.getContinuousPhase()->getViscosity());
+    testSimulation.setResistanceModel(&resistanceModel);
+
+    // simulator
+    std::string name = "Paper1a-cross-0";
+    std::string stlFile = "../examples/STL/cross.stl";
+    T charPhysLength = 1e-4;
+    T charPhysVelocity = 1e-1;
+    T resolution = 20;
+    T epsilon = 1e-1;
+    T tau = 0.55;
+    std::unordered_map<int, arch::Opening<T>> Openings;
+    Openings.try_emplace(5, arch::Opening<T>(network.getNode(5), std::vector<T>({1.0, 0.0}), 1e-4));
+    Openings.try_emplace(7, arch::Opening<T>(network.getNode(7), std::vector<T>({0.0, -1.0}), 1e-4));
+    Openings.try_emplace(8, arch::Opening<T>(network.getNode(8), std::vector<T>({0.0, 1.0}), 1e-4));
+    Openings.try_emplace(9, arch::Opening<T>(network.getNode(9), std::vector<T>({-1.0, 0.0}), 1e-4));
+
+    testSimulation.addLbmSimulator(name, stlFile, network.getModule(m0->getId()), Openings, charPhysLength, charPhysVelocity, resolution, epsilon, tau);
+    if (aitken) {
+        testSimulation.setAitkenHybridScheme(0.1, 0.5, 10);
+    } else {
+        testSimulation.setNaiveHybridScheme(0.1, 0.5, 10);
+    }
+    network.sortGroups();
+
+    // pressure pump
+    auto pressure = 1e3;
+    network.setPressurePump(c0->getId(), pressure);
+    network.setPressurePump(c1->getId(), pressure);
+    network.setPressurePump(c2->getId(), pressure);
+
+    network.isNetworkValid();
+    
+    // Simulate
+    testSimulation.simulate();
+
+    return testSimulation.getIterations();
+}
+
+TEST(Hybrid, Case1aAitken) {
+    arch::Network<T> naiveNetwork;
+    int naiveIterations = simulateCase1a(naiveNetwork, false);
+    arch::Network<T> aitkenNetwork;
+    int aitkenIterations = simulateCase1a(aitkenNetwork, true);
+
+    // The dynamic relaxation converges to the solution of the naive scheme in fewer coupling iterations
+    EXPECT_GT(aitkenIterations, 0);
+    EXPECT_LT(aitkenIterations, naiveIterations);
+
+    for (auto& [nodeId, node] : naiveNetwork.getNodes()) {
+        EXPECT_NEAR(aitkenNetwork.getNodes().at(nodeId)->getPressure(), node->getPressure(), 1e-1);
+    }
+    for (auto& [channelId, channel] : naiveNetwork.getChannels()) {
+        EXPECT_NEAR(aitkenNetwork.getChannels().at(channelId)->getFlowRate(), channel->getFlowRate(), 1e-13);
+    }
+}
+
 #ifdef USE_ESSLBM
 TEST(Hybrid, esstest) {
 
@@ -188,6 +305,48 @@ TEST(Hybrid, Case1aJSON) {
     EXPECT_NEAR(network.getChannels().at(8)->getFlowRate(), 4.69188e-9, 1e-14);
 }
 
+/**
+ * Definition of the hybrid mixing case with three species, whose AD lattices are stepped on adThreads threads.
+*/
+json mixing1bDefinition(int adThreads) {
+    std::ifstream file("../examples/Hybrid/Mixing1b.JSON");
+    json jsonString = json::parse(file);
+    jsonString["simulation"]["settings"]["simulators"][0]["adThreads"] = adThreads;
+    return jsonString;
+}
+
+TEST(Hybrid, Mixing1bAdThreads) {
+
+    // The AD lattices of the species are independent, such that stepping them concurrently does not change the results
+    json sequentialDefinition = mixing1bDefinition(1);
+    arch::Network<T> sequentialNetwork = porting::networkFromJSON<T>(sequentialDefinition);
+    sim::Simulation<T> sequentialSimulation = porting::simulationFromJSON<T>(sequentialDefinition, &sequentialNetwork);
+    sequentialNetwork.isNetworkValid();
+    sequentialSimulation.simulate();
+
+    json concurrentDefinition = mixing1bDefinition(3);
+    arch::Network<T> concurrentNetwork = porting::networkFromJSON<T>(concurrentDefinition);
+    sim::Simulation<T> concurrentSimulation = porting::simulationFromJSON<T>(concurrentDefinition, &concurrentNetwork);
+    concurrentNetwork.isNetworkValid();
+    concurrentSimulation.simulate();
+
+    for (auto& [nodeId, node] : sequentialNetwork.getNodes()) {
+        EXPECT_EQ(concurrentNetwork.getNodes().at(nodeId)->getPressure(), node->getPressure());
+    }
+    for (auto& [channelId, channel] : sequentialNetwork.getChannels()) {
+        EXPECT_EQ(concurrentNetwork.getChannels().at(channelId)->getFlowRate(), channel->getFlowRate());
+    }
+
+    ASSERT_EQ(concurrentSimulation.getMixtures().size(), sequentialSimulation.getMixtures().size());
+    for (auto& [mixtureId, mixture] : sequentialSimulation.getMixtures()) {
+        auto* concurrentMixture = concurrentSimulation.getMixture(mixtureId);
+        ASSERT_EQ(concurrentMixture->getSpecieCount(), 3);
+        for (auto& [specieId, concentration] : mixture->getSpecieConcentrations()) {
+            EXPECT_EQ(concurrentMixture->getConcentrationOfSpecie(specieId), concentration);
+        }
+    }
+}
+
 TEST(Hybrid, testCase2a) {
     
 std::string file = "../examples/Hybrid/Network2a.JSON";
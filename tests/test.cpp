@@ -4,9 +4,14 @@
 #include "gtest/gtest.h"
 
 #include "abstract/Architecture.test.cpp"
+#include "abstract/AsyncWriter.test.cpp"
 #include "abstract/BigDroplet.test.cpp"
 #include "abstract/Continuous.test.cpp"
+#include "abstract/EventScheduler.test.cpp"
+#include "abstract/Generator.test.cpp"
 #include "abstract/InstantaneousMixing.test.cpp"
+#include "abstract/MemoryPool.test.cpp"
+#include "abstract/ThreadPool.test.cpp"
 #include "abstract/Topology.test.cpp"
 #include "hybrid/Hybrid.test.cpp"
 #include "hybrid/Opening.test.cpp"